@@ -0,0 +1,20 @@
+# Writes OUTPUT header defining SNAKE_BENCH_COMMIT with the current commit of SOURCE_DIR ("unknown" outside git),
+# run on every build, the header is only rewritten when the commit changes so the benchmarks are not rebuilt for nothing
+execute_process(COMMAND git rev-parse --short HEAD
+                WORKING_DIRECTORY ${SOURCE_DIR}
+                OUTPUT_VARIABLE SNAKE_BENCH_COMMIT
+                OUTPUT_STRIP_TRAILING_WHITESPACE
+                ERROR_QUIET)
+
+if(NOT SNAKE_BENCH_COMMIT)
+  set(SNAKE_BENCH_COMMIT "unknown")
+endif()
+
+set(CONTENT "#define SNAKE_BENCH_COMMIT \"${SNAKE_BENCH_COMMIT}\"\n")
+
+if(EXISTS ${OUTPUT})
+  file(READ ${OUTPUT} CURRENT_CONTENT)
+endif()
+if(NOT CURRENT_CONTENT STREQUAL CONTENT)
+  file(WRITE ${OUTPUT} "${CONTENT}")
+endif()
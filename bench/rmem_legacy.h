@@ -0,0 +1,369 @@
+#ifndef RMEM_LEGACY_H
+#define RMEM_LEGACY_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+// rmem MemPool as it was before the size classes rework (linear free list, small sizes buckets and
+// explicit defragmentation), only kept so mempool benchmarks can compare both implementations
+// every symbol is prefixed with Legacy and static, it can be included along with rmem.h
+
+// Memory Pool
+typedef struct LegacyMemNode LegacyMemNode;
+struct LegacyMemNode {
+    size_t size;
+    LegacyMemNode *next, *prev;
+};
+
+typedef struct LegacyAllocList {
+    LegacyMemNode *head, *tail;
+    size_t len, maxNodes;
+    bool autoDefrag : 1;
+} LegacyAllocList;
+
+typedef struct LegacyStack {
+    uint8_t *mem, *base;
+    size_t size;
+} LegacyStack;
+
+#define LEGACY_MEMPOOL_BUCKET_SIZE    8
+#define LEGACY_MEMPOOL_BUCKET_BITS    3
+
+typedef struct LegacyMemPool {
+    LegacyAllocList freeList;
+    LegacyStack stack;
+    LegacyMemNode *buckets[LEGACY_MEMPOOL_BUCKET_SIZE];
+} LegacyMemPool;
+
+static void LegacyMemPoolFree(LegacyMemPool *const restrict mempool, void *ptr);
+static bool LegacyMemPoolDefrag(LegacyMemPool *const mempool);
+
+static inline size_t LegacyAlignSize(const size_t size, const size_t align)
+{
+    return (size + (align - 1)) & -align;
+}
+
+static LegacyMemPool LegacyCreateMemPool(const size_t size)
+{
+    LegacyMemPool mempool = { 0 };
+
+    if (size == 0UL) return mempool;
+    else
+    {
+        // Align the mempool size to at least the size of an alloc node.
+        mempool.stack.size = size;
+        mempool.stack.mem = malloc(mempool.stack.size*sizeof *mempool.stack.mem);
+
+        if (mempool.stack.mem==NULL)
+        {
+            mempool.stack.size = 0UL;
+            return mempool;
+        }
+        else
+        {
+            mempool.stack.base = mempool.stack.mem + mempool.stack.size;
+            return mempool;
+        }
+    }
+}
+
+static void LegacyDestroyMemPool(LegacyMemPool *const mempool)
+{
+    if ((mempool == NULL) || (mempool->stack.mem == NULL)) return;
+    else
+    {
+        free(mempool->stack.mem);
+        *mempool = (LegacyMemPool){ 0 };
+    }
+}
+
+static void *LegacyMemPoolAlloc(LegacyMemPool *const mempool, const size_t size)
+{
+    if ((mempool == NULL) || (size == 0UL) || (size > mempool->stack.size)) return NULL;
+    else
+    {
+        LegacyMemNode *new_mem = NULL;
+        const size_t ALLOC_SIZE = LegacyAlignSize(size + sizeof *new_mem, sizeof(intptr_t));
+        const size_t BUCKET_INDEX = (ALLOC_SIZE >> LEGACY_MEMPOOL_BUCKET_BITS) - 1;
+
+        // If the size is small enough, let's check if our buckets has a fitting memory block.
+        if (BUCKET_INDEX < LEGACY_MEMPOOL_BUCKET_SIZE && mempool->buckets[BUCKET_INDEX] != NULL && mempool->buckets[BUCKET_INDEX]->size >= ALLOC_SIZE)
+        {
+            new_mem = mempool->buckets[BUCKET_INDEX];
+            mempool->buckets[BUCKET_INDEX] = mempool->buckets[BUCKET_INDEX]->next;
+            if( mempool->buckets[BUCKET_INDEX] != NULL )
+                mempool->buckets[BUCKET_INDEX]->prev = NULL;
+        }
+        else if (mempool->freeList.head != NULL)
+        {
+            const size_t MEM_SPLIT_THRESHOLD = 16;
+
+            // If the freelist is valid, let's allocate FROM the freelist then!
+            for (LegacyMemNode *inode = mempool->freeList.head; inode != NULL; inode = inode->next)
+            {
+                if (inode->size < ALLOC_SIZE) continue;
+                else if (inode->size <= (ALLOC_SIZE + MEM_SPLIT_THRESHOLD))
+                {
+                    // Close in size - reduce fragmentation by not splitting.
+                    new_mem = inode;
+                    (inode->prev != NULL)? (inode->prev->next = inode->next) : (mempool->freeList.head = inode->next);
+                    (inode->next != NULL)? (inode->next->prev = inode->prev) : (mempool->freeList.tail = inode->prev);
+
+                    if (mempool->freeList.head != NULL) mempool->freeList.head->prev = NULL;
+                    else mempool->freeList.tail = NULL;
+
+                    if (mempool->freeList.tail != NULL) mempool->freeList.tail->next = NULL;
+                    mempool->freeList.len--;
+                    break;
+                }
+                else
+                {
+                    // Split the memory chunk.
+                    new_mem = (LegacyMemNode *)((uint8_t *)inode + (inode->size - ALLOC_SIZE));
+                    inode->size -= ALLOC_SIZE;
+                    new_mem->size = ALLOC_SIZE;
+                    break;
+                }
+            }
+        }
+
+        if (new_mem == NULL)
+        {
+            // not enough memory to support the size!
+            if ((mempool->stack.base - ALLOC_SIZE) < mempool->stack.mem) return NULL;
+            else
+            {
+                // Couldn't allocate from a freelist, allocate from available mempool.
+                // Subtract allocation size from the mempool.
+                mempool->stack.base -= ALLOC_SIZE;
+
+                // Use the available mempool space as the new node.
+                new_mem = (LegacyMemNode *)mempool->stack.base;
+                new_mem->size = ALLOC_SIZE;
+            }
+        }
+
+        // Visual of the allocation block.
+        // --------------
+        // | mem size   | lowest addr of block
+        // | next node  | 12 byte (32-bit) header
+        // | prev node  | 24 byte (64-bit) header
+        // --------------
+        // |   alloc'd  |
+        // |   memory   |
+        // |   space    | highest addr of block
+        // --------------
+        new_mem->next = new_mem->prev = NULL;
+        uint8_t *const final_mem = (uint8_t *)new_mem + sizeof *new_mem;
+        return memset(final_mem, 0, new_mem->size - sizeof *new_mem);
+    }
+}
+
+static void LegacyMemPoolFree(LegacyMemPool *const restrict mempool, void *ptr)
+{
+    if ((mempool == NULL) || (ptr == NULL) || ((uintptr_t)ptr - sizeof(LegacyMemNode) < (uintptr_t)mempool->stack.mem)) return;
+    else
+    {
+        // Behind the actual pointer data is the allocation info.
+        LegacyMemNode *const mem_node = (LegacyMemNode *)((uint8_t *)ptr - sizeof *mem_node);
+        const size_t BUCKET_INDEX = (mem_node->size >> LEGACY_MEMPOOL_BUCKET_BITS) - 1;
+
+        // Make sure the pointer data is valid.
+        if (((uintptr_t)mem_node < (uintptr_t)mempool->stack.base) ||
+            (((uintptr_t)mem_node - (uintptr_t)mempool->stack.mem) > mempool->stack.size) ||
+            (mem_node->size == 0UL) ||
+            (mem_node->size > mempool->stack.size)) return;
+        // If the mem_node is right at the stack base ptr, then add it to the stack.
+        else if ((uintptr_t)mem_node == (uintptr_t)mempool->stack.base)
+        {
+            mempool->stack.base += mem_node->size;
+        }
+        // attempted stack merge failed, try to place it into the memnode buckets
+        else if (BUCKET_INDEX < LEGACY_MEMPOOL_BUCKET_SIZE)
+        {
+            if (mempool->buckets[BUCKET_INDEX] == NULL) mempool->buckets[BUCKET_INDEX] = mem_node;
+            else
+            {
+                for (LegacyMemNode *n = mempool->buckets[BUCKET_INDEX]; n != NULL; n = n->next) if( n==mem_node ) return;
+                mempool->buckets[BUCKET_INDEX]->prev = mem_node;
+                mem_node->next = mempool->buckets[BUCKET_INDEX];
+                mempool->buckets[BUCKET_INDEX] = mem_node;
+            }
+        }
+        // Otherwise, we add it to the free list.
+        // We also check if the freelist already has the pointer so we can prevent double frees.
+        else /*if ((mempool->freeList.len == 0UL) || ((uintptr_t)mempool->freeList.head >= (uintptr_t)mempool->stack.mem && (uintptr_t)mempool->freeList.head - (uintptr_t)mempool->stack.mem < mempool->stack.size))*/
+        {
+            for (LegacyMemNode *n = mempool->freeList.head; n != NULL; n = n->next) if (n == mem_node) return;
+
+            // This code insertion sorts where largest size is last.
+            if (mempool->freeList.head == NULL)
+            {
+                mempool->freeList.head = mempool->freeList.tail = mem_node;
+                mempool->freeList.len++;
+            }
+            else if (mempool->freeList.head->size >= mem_node->size)
+            {
+                mem_node->next = mempool->freeList.head;
+                mem_node->next->prev = mem_node;
+                mempool->freeList.head = mem_node;
+                mempool->freeList.len++;
+            }
+            else //if (mempool->freeList.tail->size <= mem_node->size)
+            {
+                mem_node->prev = mempool->freeList.tail;
+                mempool->freeList.tail->next = mem_node;
+                mempool->freeList.tail = mem_node;
+                mempool->freeList.len++;
+            }
+
+            if (mempool->freeList.autoDefrag && (mempool->freeList.maxNodes != 0UL) && (mempool->freeList.len > mempool->freeList.maxNodes)) LegacyMemPoolDefrag(mempool);
+        }
+    }
+}
+
+static size_t LegacyGetMemPoolFreeMemory(const LegacyMemPool mempool)
+{
+    size_t total_remaining = (uintptr_t)mempool.stack.base - (uintptr_t)mempool.stack.mem;
+
+    for (LegacyMemNode *n=mempool.freeList.head; n != NULL; n = n->next) total_remaining += n->size;
+
+    for (size_t i=0; i<LEGACY_MEMPOOL_BUCKET_SIZE; i++) for (LegacyMemNode *n = mempool.buckets[i]; n != NULL; n = n->next) total_remaining += n->size;
+
+    return total_remaining;
+}
+
+static void LegacyMemPoolReset(LegacyMemPool *const mempool)
+{
+    if (mempool == NULL) return;
+    mempool->freeList.head = mempool->freeList.tail = NULL;
+    mempool->freeList.len = 0;
+    for (size_t i = 0; i < LEGACY_MEMPOOL_BUCKET_SIZE; i++) mempool->buckets[i] = NULL;
+    mempool->stack.base = mempool->stack.mem + mempool->stack.size;
+}
+
+static bool LegacyMemPoolDefrag(LegacyMemPool *const mempool)
+{
+    if (mempool == NULL) return false;
+    else
+    {
+        // If the memory pool has been entirely released, fully defrag it.
+        if (mempool->stack.size == LegacyGetMemPoolFreeMemory(*mempool))
+        {
+            LegacyMemPoolReset(mempool);
+            return true;
+        }
+        else
+        {
+            for (size_t i=0; i<LEGACY_MEMPOOL_BUCKET_SIZE; i++)
+            {
+                while (mempool->buckets[i] != NULL)
+                {
+                    if ((uintptr_t)mempool->buckets[i] == (uintptr_t)mempool->stack.base)
+                    {
+                        mempool->stack.base += mempool->buckets[i]->size;
+                        mempool->buckets[i]->size = 0;
+                        mempool->buckets[i] = mempool->buckets[i]->next;
+                        if (mempool->buckets[i] != NULL) mempool->buckets[i]->prev = NULL;
+                    }
+                    else break;
+                }
+            }
+
+            const size_t PRE_DEFRAG_LEN = mempool->freeList.len;
+            LegacyMemNode **node = &mempool->freeList.head;
+
+            while (*node != NULL)
+            {
+                if ((uintptr_t)*node == (uintptr_t)mempool->stack.base)
+                {
+                    // If node is right at the stack, merge it back into the stack.
+                    mempool->stack.base += (*node)->size;
+                    (*node)->size = 0UL;
+                    ((*node)->prev != NULL)? ((*node)->prev->next = (*node)->next) : (mempool->freeList.head = (*node)->next);
+                    ((*node)->next != NULL)? ((*node)->next->prev = (*node)->prev) : (mempool->freeList.tail = (*node)->prev);
+
+                    if (mempool->freeList.head != NULL) mempool->freeList.head->prev = NULL;
+                    else mempool->freeList.tail = NULL;
+
+                    if (mempool->freeList.tail != NULL) mempool->freeList.tail->next = NULL;
+                    mempool->freeList.len--;
+                    node = &mempool->freeList.head;
+                }
+                else if (((uintptr_t)*node + (*node)->size) == (uintptr_t)(*node)->next)
+                {
+                    // Next node is at a higher address.
+                    (*node)->size += (*node)->next->size;
+                    (*node)->next->size = 0UL;
+
+                    // <-[P Curr N]-> <-[P Next N]-> <-[P NextNext N]->
+                    //
+                    //           |--------------------|
+                    // <-[P Curr N]-> <-[P Next N]-> [P NextNext N]->
+                    if ((*node)->next->next != NULL) (*node)->next->next->prev = *node;
+
+                    // <-[P Curr N]-> <-[P NextNext N]->
+                    (*node)->next = (*node)->next->next;
+
+                    mempool->freeList.len--;
+                    node = &mempool->freeList.head;
+                }
+                else if ((((uintptr_t)*node + (*node)->size) == (uintptr_t)(*node)->prev) && ((*node)->prev->prev != NULL))
+                {
+                    // Prev node is at a higher address.
+                    (*node)->size += (*node)->prev->size;
+                    (*node)->prev->size = 0UL;
+
+                    // <-[P PrevPrev N]-> <-[P Prev N]-> <-[P Curr N]->
+                    //
+                    //               |--------------------|
+                    // <-[P PrevPrev N] <-[P Prev N]-> <-[P Curr N]->
+                    (*node)->prev->prev->next = *node;
+
+                    // <-[P PrevPrev N]-> <-[P Curr N]->
+                    (*node)->prev = (*node)->prev->prev;
+
+                    mempool->freeList.len--;
+                    node = &mempool->freeList.head;
+                }
+                else if ((*node)->prev != NULL && (*node)->next != NULL && (uintptr_t)*node - (*node)->next->size == (uintptr_t)(*node)->next)
+                {
+                    // Next node is at a lower address.
+                    (*node)->next->size += (*node)->size;
+
+                    (*node)->size = 0UL;
+                    (*node)->next->prev = (*node)->prev;
+                    (*node)->prev->next = (*node)->next;
+                    *node = (*node)->next;
+
+                    mempool->freeList.len--;
+                    node = &mempool->freeList.head;
+                }
+                else if ((*node)->prev != NULL && (*node)->next != NULL && (uintptr_t)*node - (*node)->prev->size == (uintptr_t)(*node)->prev)
+                {
+                    // Prev node is at a lower address.
+                    (*node)->prev->size += (*node)->size;
+
+                    (*node)->size = 0UL;
+                    (*node)->next->prev = (*node)->prev;
+                    (*node)->prev->next = (*node)->next;
+                    *node = (*node)->prev;
+
+                    mempool->freeList.len--;
+                    node = &mempool->freeList.head;
+                }
+                else
+                {
+                    node = &(*node)->next;
+                }
+            }
+
+            return PRE_DEFRAG_LEN > mempool->freeList.len;
+        }
+    }
+}
+
+#endif // RMEM_LEGACY_H
@@ -0,0 +1,354 @@
+#if !defined(_WIN32)
+#define _POSIX_C_SOURCE 199309L     // required for: clock_gettime(), CLOCK_THREAD_CPUTIME_ID
+#endif
+
+#include "snake.h"
+#include "rlgl.h"
+#include "bench_commit.h"           // SNAKE_BENCH_COMMIT, generated on every build
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+// render stress-scene benchmark: every scene is drawn for a fixed number of frames with vsync and
+// frame rate limit disabled, reporting frames per second, main thread CPU time per frame and the
+// rlgl render statistics per frame (draw calls, vertices, flushes by reason, texture binds, shader
+// switches and uploaded bytes), so rendering changes can be compared objectively
+//
+// usage: scene_bench [--scene <text>] [--frames <count>] [--json <file>]
+
+#define SCENE_FRAMES 300
+#define SCENE_WARMUP_FRAMES 10
+#define SCENE_SEED 1234
+#define SCREEN_WIDTH 1280
+#define SCREEN_HEIGHT 720
+
+#define SCENE_RECTANGLES 100000
+#define SCENE_GLYPHS 50000
+#define SCENE_SPRITES 10000
+#define SCENE_SNAKE_LENGTH 1000000
+#define SCENE_SNAKE_MAP_SIZE 1000       // the 1M-segment snake fills a 1000x1000 board
+
+typedef struct Scene {
+    const char *name;
+    void (*load)(void);
+    void (*draw)(void);
+    void (*unload)(void);
+} Scene;
+
+typedef struct SceneResult {
+    const char *name;
+    int frames;
+    double framesPerSecond;
+    double frameTime;               // milliseconds, wall time
+    double cpuTime;                 // milliseconds, main thread CPU time
+    double drawCalls;               // per frame
+    double vertices;                // per frame
+    double flushes;                 // per frame
+    double flushReasons[RL_FLUSH_REASONS];  // per frame
+    double textureBinds;            // per frame
+    double shaderSwitches;          // per frame
+    double uploadedKB;              // per frame
+} SceneResult;
+
+/* ------------------------- SCENES ------------------------- */
+
+typedef struct SceneItem {
+    Vector2 position;
+    Color color;
+} SceneItem;
+
+static SceneItem *items = NULL;
+
+static void LoadItems(int count) {
+    items = (SceneItem *)malloc(count * sizeof(SceneItem));
+    for (int i = 0; i < count; i++) {
+        items[i].position = (Vector2){ rand() % SCREEN_WIDTH, rand() % SCREEN_HEIGHT };
+        items[i].color = (Color){ rand() % 256, rand() % 256, rand() % 256, 255 };
+    }
+}
+
+static void UnloadItems(void) {
+    free(items);
+    items = NULL;
+}
+
+static void LoadRectangles(void) {
+    LoadItems(SCENE_RECTANGLES);
+}
+
+static void DrawRectangles(void) {
+    for (int i = 0; i < SCENE_RECTANGLES; i++) {
+        DrawRectangle(items[i].position.x, items[i].position.y, 8, 8, items[i].color);
+    }
+}
+
+// 1000 lines of 50 glyphs
+#define GLYPHS_LINE_LENGTH 50
+
+static void LoadGlyphs(void) {
+    LoadItems(SCENE_GLYPHS / GLYPHS_LINE_LENGTH);
+}
+
+static void DrawGlyphs(void) {
+    static const char *line = "the quick brown fox jumps over the lazy snake 0123";
+    Font font = GetFontDefault();
+    for (int i = 0; i < SCENE_GLYPHS / GLYPHS_LINE_LENGTH; i++) {
+        DrawTextEx(font, line, items[i].position, 10, 1, items[i].color);
+    }
+}
+
+static Texture2D spriteTexture;
+
+static void LoadSprites(void) {
+    LoadItems(SCENE_SPRITES);
+    Image image = GenImageChecked(32, 32, 8, 8, GREEN, DARKGREEN);
+    spriteTexture = LoadTextureFromImage(image);
+    UnloadImage(image);
+}
+
+static void DrawSprites(void) {
+    for (int i = 0; i < SCENE_SPRITES; i++) {
+        DrawTextureRec(spriteTexture, (Rectangle){ 0, 0, 32, 32 }, items[i].position, items[i].color);
+    }
+}
+
+static void UnloadSprites(void) {
+    UnloadTexture(spriteTexture);
+    UnloadItems();
+}
+
+static GameState gameState;
+static Snake snake;
+static unsigned char *board = NULL;
+static TileMap tileMap;
+static Booster boosters[3];
+
+// the snake fills the board row by row, it moves one cell every frame like in the game
+static void LoadLongSnake(void) {
+    gameState = (GameState){ .mapWidth = SCENE_SNAKE_MAP_SIZE, .mapHeight = SCENE_SNAKE_MAP_SIZE };
+    board = (unsigned char *)calloc(SCENE_SNAKE_MAP_SIZE * SCENE_SNAKE_MAP_SIZE, 1);
+    tileMap = LoadTileMap(SCENE_SNAKE_MAP_SIZE, SCENE_SNAKE_MAP_SIZE, 1);
+
+    snake.length = SCENE_SNAKE_LENGTH;
+    snake.body = (Vector2 *)malloc(snake.length * sizeof(Vector2));
+    for (int i = 0; i < snake.length; i++) {
+        int row = i / SCENE_SNAKE_MAP_SIZE;
+        int col = (row % 2 == 0)? i % SCENE_SNAKE_MAP_SIZE : SCENE_SNAKE_MAP_SIZE - 1 - i % SCENE_SNAKE_MAP_SIZE;
+        snake.body[i] = (Vector2){ col, row };
+    }
+    snake.direction = (Vector2){ 1, 0 };
+}
+
+static void DrawLongSnake(void) {
+    memset(board, CELL_EMPTY, gameState.mapWidth * gameState.mapHeight);
+    DrawSnake(board, &gameState, &snake);
+    DrawBoard(&tileMap, board, &gameState);
+
+    MoveSnake(&snake);
+    snake.direction = (Vector2){ -snake.direction.x, 0 };
+}
+
+static void UnloadLongSnake(void) {
+    UnloadTileMap(tileMap);
+    free(snake.body);
+    free(board);
+}
+
+// maximum size board with a long snake, both letters and every booster type
+static void LoadFullBoard(void) {
+    gameState = (GameState){
+        .wordList = {"ccu", "pineapple", "taiwan"},
+        .mapWidth = MAX_SIZE,
+        .mapHeight = MAX_SIZE,
+        .boosterTimer = 3.0f,
+    };
+    InitWordGame(&gameState);
+    GenerateLetterChoices(&gameState);
+
+    board = (unsigned char *)calloc(MAX_SIZE * MAX_SIZE, 1);
+    tileMap = LoadTileMap(MAX_SIZE, MAX_SIZE, GRID_CELL_SIZE);
+
+    snake.length = 64;
+    snake.body = (Vector2 *)malloc(snake.length * sizeof(Vector2));
+    for (int i = 0; i < snake.length; i++) {
+        int row = i / 16;
+        int col = (row % 2 == 0)? i % 16 : 15 - i % 16;
+        snake.body[i] = (Vector2){ 2 + col, 2 + row * 2 };
+    }
+    snake.direction = (Vector2){ 1, 0 };
+
+    for (int i = 0; i < 3; i++) InitBooster(&boosters[i], i, &gameState);
+}
+
+static void DrawFullBoard(void) {
+    memset(board, CELL_EMPTY, gameState.mapWidth * gameState.mapHeight);
+    DrawWalls(board, &gameState);
+    DrawSnake(board, &gameState, &snake);
+    DrawLetterCells(board, &gameState, &letter1, &letter2);
+    for (int i = 0; i < 3; i++) DrawBooster(board, &gameState, &boosters[i]);
+
+    DrawBoard(&tileMap, board, &gameState);
+    DrawLetters(&letter1, &letter2);
+    DrawGuessedWord(&gameState);
+    DrawText(TextFormatFrame("Lives: %d", gameState.extraLives + 1), 10, 10, 20, RAYWHITE);
+    DrawText(TextFormatFrame("SPEED BOOST!!! %.2f", gameState.boosterTimer), 10, 70, 20, YELLOW);
+
+    MoveSnake(&snake);
+    snake.direction = (Vector2){ -snake.direction.x, 0 };
+}
+
+static void UnloadFullBoard(void) {
+    UnloadTileMap(tileMap);
+    free(snake.body);
+    free(board);
+}
+
+static const Scene scenes[] = {
+    { "rectangles-100k", LoadRectangles, DrawRectangles, UnloadItems },
+    { "glyphs-50k", LoadGlyphs, DrawGlyphs, UnloadItems },
+    { "sprites-10k", LoadSprites, DrawSprites, UnloadSprites },
+    { "snake-1M", LoadLongSnake, DrawLongSnake, UnloadLongSnake },
+    { "board-full", LoadFullBoard, DrawFullBoard, UnloadFullBoard },
+};
+
+/* ------------------------- RUNNER ------------------------- */
+
+// main thread CPU time in seconds
+static double GetCpuTime(void) {
+#if defined(_WIN32)
+    return (double)clock() / CLOCKS_PER_SEC;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+}
+
+static void DrawSceneFrame(const Scene *scene) {
+    BeginDrawing();
+    ClearBackground(BLACK);
+    scene->draw();
+    EndDrawing();
+}
+
+// adds the render statistics of the frame just ended to the scene totals
+static void AddRenderStats(RenderStats *total) {
+    RenderStats frame = rlGetRenderStats();
+
+    total->drawCalls += frame.drawCalls;
+    total->vertexCount += frame.vertexCount;
+    total->flushCount += frame.flushCount;
+    for (int i = 0; i < RL_FLUSH_REASONS; i++) total->flushReasons[i] += frame.flushReasons[i];
+    total->textureBinds += frame.textureBinds;
+    total->shaderSwitches += frame.shaderSwitches;
+    total->uploadedBytes += frame.uploadedBytes;
+}
+
+static SceneResult RunScene(const Scene *scene, int frames) {
+    SceneResult result = { scene->name, frames };
+    RenderStats total = { 0 };
+
+    srand(SCENE_SEED);
+    scene->load();
+
+    for (int i = 0; i < SCENE_WARMUP_FRAMES; i++) DrawSceneFrame(scene);
+
+    double startTime = GetTime();
+    double startCpuTime = GetCpuTime();
+
+    for (int i = 0; i < frames; i++) {
+        DrawSceneFrame(scene);
+        AddRenderStats(&total);
+    }
+
+    double elapsed = GetTime() - startTime;
+    double cpuElapsed = GetCpuTime() - startCpuTime;
+
+    scene->unload();
+
+    result.framesPerSecond = (elapsed > 0.0)? frames / elapsed : 0.0;
+    result.frameTime = elapsed * 1000.0 / frames;
+    result.cpuTime = cpuElapsed * 1000.0 / frames;
+    result.drawCalls = (double)total.drawCalls / frames;
+    result.vertices = (double)total.vertexCount / frames;
+    result.flushes = (double)total.flushCount / frames;
+    for (int i = 0; i < RL_FLUSH_REASONS; i++) result.flushReasons[i] = (double)total.flushReasons[i] / frames;
+    result.textureBinds = (double)total.textureBinds / frames;
+    result.shaderSwitches = (double)total.shaderSwitches / frames;
+    result.uploadedKB = total.uploadedBytes / 1024.0 / frames;
+
+    return result;
+}
+
+static bool SaveResults(const char *fileName, SceneResult *results, int count) {
+    FILE *file = fopen(fileName, "w");
+    if (file == NULL) return false;
+
+    fprintf(file, "{\n  \"commit\": \"%s\",\n  \"timestamp\": %lld,\n  \"scenes\": [\n",
+            SNAKE_BENCH_COMMIT, (long long)time(NULL));
+    for (int i = 0; i < count; i++) {
+        const double *reasons = results[i].flushReasons;
+
+        fprintf(file, "    { \"name\": \"%s\", \"frames\": %d, \"fps\": %.2f, \"frame_ms\": %.3f, \"cpu_ms\": %.3f, "
+                "\"draw_calls\": %.1f, \"vertices\": %.1f, \"flushes\": %.1f, "
+                "\"flush_reasons\": { \"state\": %.1f, \"buffer_full\": %.1f, \"drawcalls_full\": %.1f, \"matrix\": %.1f, \"end_frame\": %.1f }, "
+                "\"texture_binds\": %.1f, \"shader_switches\": %.1f, \"uploaded_kb\": %.1f }%s\n",
+                results[i].name, results[i].frames, results[i].framesPerSecond, results[i].frameTime, results[i].cpuTime,
+                results[i].drawCalls, results[i].vertices, results[i].flushes,
+                reasons[RL_FLUSH_STATE], reasons[RL_FLUSH_BUFFER_FULL], reasons[RL_FLUSH_DRAWCALLS_FULL], reasons[RL_FLUSH_MATRIX], reasons[RL_FLUSH_END_FRAME],
+                results[i].textureBinds, results[i].shaderSwitches, results[i].uploadedKB, (i < count - 1)? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+    fclose(file);
+
+    return true;
+}
+
+int main(int argc, char **argv) {
+    const char *filter = NULL;
+    const char *jsonFile = "scene_bench.json";
+    int frames = SCENE_FRAMES;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--scene") == 0 && i + 1 < argc) filter = argv[++i];
+        else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) jsonFile = argv[++i];
+        else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) frames = atoi(argv[++i]);
+        else {
+            printf("usage: %s [--scene <text>] [--frames <count>] [--json <file>]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (frames < 1) frames = 1;
+
+    // no FLAG_VSYNC_HINT and no target FPS: frames are drawn as fast as possible
+    SetTraceLogLevel(LOG_WARNING);
+    InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "scene_bench");
+    SetTargetFPS(0);
+
+    int scenesCount = sizeof(scenes) / sizeof(scenes[0]);
+    SceneResult results[sizeof(scenes) / sizeof(scenes[0])];
+    int resultsCount = 0;
+
+    printf("%-18s %8s %10s %10s %10s %12s %12s %10s %8s %8s %12s\n", "scene", "frames", "fps", "frame ms", "cpu ms",
+           "draw calls", "vertices", "flushes", "binds", "shaders", "upload KB");
+    for (int i = 0; i < scenesCount; i++) {
+        if (filter != NULL && strstr(scenes[i].name, filter) == NULL) continue;
+
+        SceneResult result = RunScene(&scenes[i], frames);
+        printf("%-18s %8d %10.1f %10.3f %10.3f %12.1f %12.1f %10.1f %8.1f %8.1f %12.1f\n", result.name, result.frames,
+               result.framesPerSecond, result.frameTime, result.cpuTime, result.drawCalls, result.vertices, result.flushes,
+               result.textureBinds, result.shaderSwitches, result.uploadedKB);
+        results[resultsCount++] = result;
+    }
+
+    CloseWindow();
+
+    if (!SaveResults(jsonFile, results, resultsCount)) {
+        printf("could not write %s\n", jsonFile);
+        return 1;
+    }
+    printf("results written to %s\n", jsonFile);
+
+    return 0;
+}
@@ -0,0 +1,481 @@
+#include "snake.h"
+#include "rlgl.h"
+#include "rmem.h"
+#include "rmem_legacy.h"            // MemPool before the size classes rework, compared with the current one
+#include "bench_commit.h"           // SNAKE_BENCH_COMMIT, generated on every build
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+// micro-benchmarks of the game and engine hot paths
+// every benchmark runs a batch of iterations per sample, the batch size is calibrated so a sample
+// lasts about BENCH_SAMPLE_TIME; results are the median time per iteration and its median absolute
+// deviation (MAD) over all the samples, written to a JSON file to compare them across commits
+//
+// usage: snake_bench [--filter <text>] [--samples <count>] [--json <file>]
+
+#define BENCH_SAMPLES 25
+#define BENCH_MAX_SAMPLES 256
+#define BENCH_SAMPLE_TIME 0.01      // seconds
+#define BENCH_MIN_ITERATIONS 16     // per sample, slow benchmarks are still averaged over a few runs
+#define BENCH_SEED 1234
+
+typedef struct Benchmark {
+    const char *name;
+    void (*setup)(void);            // called once before the samples, can be NULL
+    void (*run)(int iterations);
+    void (*teardown)(void);         // called once after the samples, can be NULL
+} Benchmark;
+
+typedef struct BenchResult {
+    const char *name;
+    int iterations;                 // iterations per sample
+    int samples;
+    double median;                  // nanoseconds per iteration
+    double mad;                     // nanoseconds per iteration
+    double opsPerSecond;
+} BenchResult;
+
+// results are accumulated here so the compiler can't drop the benchmarked calls
+static volatile int benchSink = 0;
+
+/* ------------------------- GAME FIXTURES ------------------------- */
+
+static GameState gameState;
+static Snake snake;
+static unsigned char board[MAX_SIZE * MAX_SIZE];
+static TileMap tileMap;
+
+static void SetupGame(void) {
+    gameState = (GameState){
+        .wordList = {"ccu", "pineapple", "taiwan"},
+        .mapWidth = MAX_SIZE,
+        .mapHeight = MAX_SIZE,
+    };
+    InitWordGame(&gameState);
+
+    // a long snake coiled in the middle of the map, not touching itself
+    snake.length = 64;
+    snake.body = (Vector2 *)malloc(snake.length * sizeof(Vector2));
+    for (int i = 0; i < snake.length; i++) {
+        int row = i / 16;
+        int col = (row % 2 == 0)? i % 16 : 15 - i % 16;
+        snake.body[i] = (Vector2){2 + col, 2 + row * 2};
+    }
+    snake.direction = (Vector2){1, 0};
+}
+
+static void TeardownGame(void) {
+    free(snake.body);
+    snake.body = NULL;
+}
+
+static void RunMoveSnake(int iterations) {
+    for (int i = 0; i < iterations; i++) {
+        MoveSnake(&snake);
+        snake.direction = (Vector2){-snake.direction.x, 0}; // keep the snake in place
+    }
+    benchSink += (int)snake.body[0].x;
+}
+
+static void RunCheckCollision(int iterations) {
+    int collisions = 0;
+    for (int i = 0; i < iterations; i++) {
+        collisions += CheckCollision(&snake, &gameState);
+    }
+    benchSink += collisions;
+}
+
+static void RunGenerateLetterChoices(int iterations) {
+    for (int i = 0; i < iterations; i++) {
+        GenerateLetterChoices(&gameState);
+    }
+    benchSink += letter1.value;
+}
+
+static void RunDrawSnake(int iterations) {
+    for (int i = 0; i < iterations; i++) {
+        memset(board, CELL_EMPTY, gameState.mapWidth * gameState.mapHeight);
+        DrawWalls(board, &gameState);
+        DrawSnake(board, &gameState, &snake);
+    }
+    benchSink += board[gameState.mapWidth + 2];
+}
+
+static void SetupTileMap(void) {
+    SetupGame();
+    tileMap = LoadTileMap(gameState.mapWidth, gameState.mapHeight, GRID_CELL_SIZE);
+    memset(board, CELL_EMPTY, sizeof(board));
+    DrawWalls(board, &gameState);
+}
+
+static void TeardownTileMap(void) {
+    UnloadTileMap(tileMap);
+    TeardownGame();
+}
+
+// the snake moves one cell per iteration, so some cells change every frame like in the game
+static void RunDrawBoard(int iterations) {
+    for (int i = 0; i < iterations; i++) {
+        DrawSnake(board, &gameState, &snake);
+        DrawBoard(&tileMap, board, &gameState);
+        rlglDraw();
+        PaintCell(board, &gameState, snake.body[snake.length - 1], CELL_EMPTY);
+        MoveSnake(&snake);
+        snake.direction = (Vector2){-snake.direction.x, 0};
+    }
+}
+
+/* ------------------------- ENGINE FIXTURES ------------------------- */
+
+// quads are tiny so the timings are dominated by vertex submission and upload, not by rasterization
+#define BENCH_QUADS 1000
+#define BENCH_QUAD_SIZE 2
+
+static float quadVertices[BENCH_QUADS * 4 * 2];
+static unsigned char quadColors[BENCH_QUADS * 4 * 4];
+
+static void SetupQuads(void) {
+    for (int q = 0; q < BENCH_QUADS; q++) {
+        float x = (q % 40) * GRID_CELL_SIZE;
+        float y = (q / 40) * GRID_CELL_SIZE;
+        float corners[8] = { x, y, x, y + BENCH_QUAD_SIZE, x + BENCH_QUAD_SIZE, y + BENCH_QUAD_SIZE, x + BENCH_QUAD_SIZE, y };
+        memcpy(&quadVertices[q * 8], corners, sizeof(corners));
+        for (int v = 0; v < 4; v++) {
+            Color color = GetCellColor(1 + q % (CELL_STATES - 1));
+            memcpy(&quadColors[(q * 4 + v) * 4], &color, 4);
+        }
+    }
+}
+
+// one iteration submits BENCH_QUADS quads and flushes the batch
+static void RunDrawRectangle(int iterations) {
+    for (int i = 0; i < iterations; i++) {
+        for (int q = 0; q < BENCH_QUADS; q++) {
+            DrawRectangle((int)quadVertices[q * 8], (int)quadVertices[q * 8 + 1], BENCH_QUAD_SIZE, BENCH_QUAD_SIZE, GetCellColor(1 + q % (CELL_STATES - 1)));
+        }
+        rlglDraw();
+    }
+}
+
+static void RunVertexArray(int iterations) {
+    for (int i = 0; i < iterations; i++) {
+        rlVertexArray2f(RL_QUADS, quadVertices, NULL, quadColors, BENCH_QUADS * 4);
+        rlglDraw();
+    }
+}
+
+static void RunTextFormat(int iterations) {
+    for (int i = 0; i < iterations; i++) {
+        benchSink += TextFormat("Lives: %d", i)[7];
+    }
+}
+
+static void RunTextFormatFloat(int iterations) {
+    for (int i = 0; i < iterations; i++) {
+        benchSink += TextFormat("SPEED BOOST!!! %.2f", i * 0.01f)[15];
+    }
+}
+
+// printf path, the baseline of the fast formatting
+static void RunSnprintf(int iterations) {
+    char buffer[64];
+    for (int i = 0; i < iterations; i++) {
+        snprintf(buffer, sizeof(buffer), "Lives: %d", i);
+        benchSink += buffer[7];
+    }
+}
+
+static void RunTextFormatBuffer(int iterations) {
+    char buffer[64];
+    for (int i = 0; i < iterations; i++) {
+        benchSink += TextFormatBuffer(buffer, sizeof(buffer), "Lives: %d", i);
+    }
+}
+
+static void RunMeasureTextEx(int iterations) {
+    Font font = GetFontDefault();
+    float width = 0.0f;
+    for (int i = 0; i < iterations; i++) {
+        width += MeasureTextEx(font, "Word: p_n_a_p_l_", 20, 2).x;
+    }
+    benchSink += (int)width;
+}
+
+static Image sourceImage;
+
+static void SetupImage(void) {
+    sourceImage = GenImageGradientRadial(256, 256, 0.5f, RED, BLUE);
+}
+
+static void TeardownImage(void) {
+    UnloadImage(sourceImage);
+}
+
+// ImageResize() and ImageFormat() modify the image, every iteration works on a copy:
+// subtract the ImageCopy result to get their own time
+static void RunImageCopy(int iterations) {
+    for (int i = 0; i < iterations; i++) {
+        Image image = ImageCopy(sourceImage);
+        benchSink += ((unsigned char *)image.data)[0];
+        UnloadImage(image);
+    }
+}
+
+static void RunImageResize(int iterations) {
+    for (int i = 0; i < iterations; i++) {
+        Image image = ImageCopy(sourceImage);
+        ImageResize(&image, 128, 128);
+        benchSink += ((unsigned char *)image.data)[0];
+        UnloadImage(image);
+    }
+}
+
+static void RunImageFormat(int iterations) {
+    for (int i = 0; i < iterations; i++) {
+        Image image = ImageCopy(sourceImage);
+        ImageFormat(&image, UNCOMPRESSED_R5G6B5);
+        benchSink += ((unsigned char *)image.data)[0];
+        UnloadImage(image);
+    }
+}
+
+/* ------------------------- ALLOCATOR FIXTURES ------------------------- */
+
+// allocators replay the same churn: a set of live allocations where every iteration frees one
+// slot and allocates it again with a new size, sizes are mostly small with a long tail of big ones
+// NOTE: MemPoolAlloc() returns zeroed memory, so malloc benchmark uses calloc() to be comparable
+
+#define BENCH_ALLOC_SLOTS 1024
+#define BENCH_ALLOC_OPS 4096
+#define BENCH_POOL_SIZE (32 * 1024 * 1024)
+
+static void *allocSlots[BENCH_ALLOC_SLOTS];
+static int allocOpSlots[BENCH_ALLOC_OPS];
+static size_t allocOpSizes[BENCH_ALLOC_OPS];
+static int allocOp = 0;
+static int allocFailures = 0;
+static MemPool memPool;
+static LegacyMemPool legacyMemPool;
+
+static size_t RandomAllocSize(void) {
+    int r = rand() % 100;
+    if (r < 70) return 16 + rand() % 240;
+    if (r < 95) return 256 + rand() % 3840;
+    return 4096 + rand() % 61440;
+}
+
+// same operations for every allocator
+static void SetupAllocOps(void) {
+    srand(BENCH_SEED);
+    for (int i = 0; i < BENCH_ALLOC_OPS; i++) {
+        allocOpSlots[i] = rand() % BENCH_ALLOC_SLOTS;
+        allocOpSizes[i] = RandomAllocSize();
+    }
+    allocOp = 0;
+    allocFailures = 0;
+}
+
+static void ReportAllocFailures(const char *name) {
+    if (allocFailures > 0) printf("%s: %d allocations failed (out of pool memory)\n", name, allocFailures);
+}
+
+static void SetupMalloc(void) {
+    SetupAllocOps();
+    for (int i = 0; i < BENCH_ALLOC_SLOTS; i++) allocSlots[i] = calloc(RandomAllocSize(), 1);
+}
+
+static void TeardownMalloc(void) {
+    for (int i = 0; i < BENCH_ALLOC_SLOTS; i++) free(allocSlots[i]);
+}
+
+static void RunMalloc(int iterations) {
+    for (int i = 0; i < iterations; i++, allocOp = (allocOp + 1) % BENCH_ALLOC_OPS) {
+        int slot = allocOpSlots[allocOp];
+        free(allocSlots[slot]);
+        allocSlots[slot] = calloc(allocOpSizes[allocOp], 1);
+    }
+}
+
+static void SetupMemPool(void) {
+    SetupAllocOps();
+    memPool = CreateMemPool(BENCH_POOL_SIZE);
+    for (int i = 0; i < BENCH_ALLOC_SLOTS; i++) allocSlots[i] = MemPoolAlloc(&memPool, RandomAllocSize());
+}
+
+static void TeardownMemPool(void) {
+    ReportAllocFailures("MemPool");
+    DestroyMemPool(&memPool);
+}
+
+static void RunMemPool(int iterations) {
+    for (int i = 0; i < iterations; i++, allocOp = (allocOp + 1) % BENCH_ALLOC_OPS) {
+        int slot = allocOpSlots[allocOp];
+        MemPoolFree(&memPool, allocSlots[slot]);
+        allocSlots[slot] = MemPoolAlloc(&memPool, allocOpSizes[allocOp]);
+        if (allocSlots[slot] == NULL) allocFailures++;
+    }
+}
+
+static void SetupLegacyMemPool(void) {
+    SetupAllocOps();
+    legacyMemPool = LegacyCreateMemPool(BENCH_POOL_SIZE);
+    for (int i = 0; i < BENCH_ALLOC_SLOTS; i++) allocSlots[i] = LegacyMemPoolAlloc(&legacyMemPool, RandomAllocSize());
+}
+
+static void TeardownLegacyMemPool(void) {
+    ReportAllocFailures("LegacyMemPool");
+    LegacyDestroyMemPool(&legacyMemPool);
+}
+
+static void RunLegacyMemPool(int iterations) {
+    for (int i = 0; i < iterations; i++, allocOp = (allocOp + 1) % BENCH_ALLOC_OPS) {
+        int slot = allocOpSlots[allocOp];
+        LegacyMemPoolFree(&legacyMemPool, allocSlots[slot]);
+        allocSlots[slot] = LegacyMemPoolAlloc(&legacyMemPool, allocOpSizes[allocOp]);
+        if (allocSlots[slot] == NULL) allocFailures++;
+    }
+}
+
+static const Benchmark benchmarks[] = {
+    { "MoveSnake", SetupGame, RunMoveSnake, TeardownGame },
+    { "CheckCollision", SetupGame, RunCheckCollision, TeardownGame },
+    { "GenerateLetterChoices", SetupGame, RunGenerateLetterChoices, TeardownGame },
+    { "DrawSnake", SetupGame, RunDrawSnake, TeardownGame },
+    { "DrawBoard", SetupTileMap, RunDrawBoard, TeardownTileMap },
+    { "DrawRectangle/1000", SetupQuads, RunDrawRectangle, NULL },
+    { "rlVertexArray2f/1000", SetupQuads, RunVertexArray, NULL },
+    { "TextFormat", NULL, RunTextFormat, NULL },
+    { "TextFormat/Float", NULL, RunTextFormatFloat, NULL },
+    { "TextFormatBuffer", NULL, RunTextFormatBuffer, NULL },
+    { "snprintf", NULL, RunSnprintf, NULL },
+    { "MeasureTextEx", NULL, RunMeasureTextEx, NULL },
+    { "ImageCopy/256", SetupImage, RunImageCopy, TeardownImage },
+    { "ImageResize/256->128", SetupImage, RunImageResize, TeardownImage },
+    { "ImageFormat/256/R5G6B5", SetupImage, RunImageFormat, TeardownImage },
+    { "Alloc/malloc", SetupMalloc, RunMalloc, TeardownMalloc },
+    { "Alloc/MemPool", SetupMemPool, RunMemPool, TeardownMemPool },
+    { "Alloc/LegacyMemPool", SetupLegacyMemPool, RunLegacyMemPool, TeardownLegacyMemPool },
+};
+
+/* ------------------------- RUNNER ------------------------- */
+
+static int CompareDouble(const void *a, const void *b) {
+    double da = *(const double *)a;
+    double db = *(const double *)b;
+    return (da > db) - (da < db);
+}
+
+// values are sorted in place
+static double Median(double *values, int count) {
+    qsort(values, count, sizeof(double), CompareDouble);
+    return (count % 2 == 1)? values[count / 2] : (values[count / 2 - 1] + values[count / 2]) / 2.0;
+}
+
+static double TimeRun(const Benchmark *benchmark, int iterations) {
+    double start = GetTime();
+    benchmark->run(iterations);
+    return GetTime() - start;
+}
+
+static BenchResult RunBenchmark(const Benchmark *benchmark, int samples) {
+    BenchResult result = { benchmark->name, 1, samples, 0.0, 0.0, 0.0 };
+    double times[BENCH_MAX_SAMPLES];
+
+    if (benchmark->setup != NULL) benchmark->setup();
+
+    // untimed warm-up run, so the calibration doesn't measure cold caches and first-use initialization
+    benchmark->run(BENCH_MIN_ITERATIONS);
+
+    // double the iterations until a run is long enough to be measured, then scale it to the sample time
+    double elapsed = TimeRun(benchmark, result.iterations);
+    while (elapsed < BENCH_SAMPLE_TIME / 10 && result.iterations < (1 << 30)) {
+        result.iterations *= 2;
+        elapsed = TimeRun(benchmark, result.iterations);
+    }
+    if (elapsed > 0.0 && elapsed < BENCH_SAMPLE_TIME) {
+        result.iterations = (int)(result.iterations * (BENCH_SAMPLE_TIME / elapsed));
+    }
+    if (result.iterations < BENCH_MIN_ITERATIONS) result.iterations = BENCH_MIN_ITERATIONS;
+
+    for (int i = 0; i < samples; i++) {
+        times[i] = TimeRun(benchmark, result.iterations) * 1e9 / result.iterations;
+    }
+
+    result.median = Median(times, samples);
+    for (int i = 0; i < samples; i++) {
+        times[i] = (times[i] > result.median)? times[i] - result.median : result.median - times[i];
+    }
+    result.mad = Median(times, samples);
+    result.opsPerSecond = (result.median > 0.0)? 1e9 / result.median : 0.0;
+
+    if (benchmark->teardown != NULL) benchmark->teardown();
+
+    return result;
+}
+
+static bool SaveResults(const char *fileName, BenchResult *results, int count, int samples) {
+    FILE *file = fopen(fileName, "w");
+    if (file == NULL) return false;
+
+    fprintf(file, "{\n  \"commit\": \"%s\",\n  \"timestamp\": %lld,\n  \"samples\": %d,\n  \"benchmarks\": [\n",
+            SNAKE_BENCH_COMMIT, (long long)time(NULL), samples);
+    for (int i = 0; i < count; i++) {
+        fprintf(file, "    { \"name\": \"%s\", \"iterations\": %d, \"median_ns\": %.3f, \"mad_ns\": %.3f, \"ops_per_second\": %.1f }%s\n",
+                results[i].name, results[i].iterations, results[i].median, results[i].mad, results[i].opsPerSecond,
+                (i < count - 1)? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+    fclose(file);
+
+    return true;
+}
+
+int main(int argc, char **argv) {
+    const char *filter = NULL;
+    const char *jsonFile = "snake_bench.json";
+    int samples = BENCH_SAMPLES;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) filter = argv[++i];
+        else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) jsonFile = argv[++i];
+        else if (strcmp(argv[i], "--samples") == 0 && i + 1 < argc) samples = atoi(argv[++i]);
+        else {
+            printf("usage: %s [--filter <text>] [--samples <count>] [--json <file>]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (samples < 1) samples = 1;
+    if (samples > BENCH_MAX_SAMPLES) samples = BENCH_MAX_SAMPLES;
+
+    // the rendering benchmarks need a GL context, the window is never shown
+    SetTraceLogLevel(LOG_WARNING);
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    InitWindow(800, 600, "snake_bench");
+
+    srand(BENCH_SEED);
+
+    int benchmarksCount = sizeof(benchmarks) / sizeof(benchmarks[0]);
+    BenchResult results[sizeof(benchmarks) / sizeof(benchmarks[0])];
+    int resultsCount = 0;
+
+    printf("%-26s %12s %12s %10s %14s\n", "benchmark", "iterations", "median ns", "MAD ns", "ops/s");
+    for (int i = 0; i < benchmarksCount; i++) {
+        if (filter != NULL && strstr(benchmarks[i].name, filter) == NULL) continue;
+
+        BenchResult result = RunBenchmark(&benchmarks[i], samples);
+        printf("%-26s %12d %12.1f %10.1f %14.0f\n", result.name, result.iterations, result.median, result.mad, result.opsPerSecond);
+        results[resultsCount++] = result;
+    }
+
+    CloseWindow();
+
+    if (!SaveResults(jsonFile, results, resultsCount, samples)) {
+        printf("could not write %s\n", jsonFile);
+        return 1;
+    }
+    printf("results written to %s\n", jsonFile);
+
+    return 0;
+}
@@ -56,6 +56,24 @@
 #define SUPPORT_SCREEN_CAPTURE      1
 // Allow automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback()
 #define SUPPORT_GIF_RECORDING       1
+// Read screenshots and gif frames asynchronously (pixel buffer objects) and encode them on a worker thread
+// NOTE: Only OpenGL 3.3 desktop with POSIX threads, screenshot files are written some frames later
+#define SUPPORT_ASYNC_SCREEN_CAPTURE 1
+// Allow recording every frame drawn as raw video (RGBA or Y4M) into a file or pipe: BeginVideoRecording()
+// NOTE: Requires SUPPORT_ASYNC_SCREEN_CAPTURE
+#define SUPPORT_VIDEO_RECORDING     1
+// Keep a rolling window of frame time breakdowns (update, draw, swap, poll, wait): GetFrameStats()
+// NOTE: Enables the frame time graph overlay: ToggleFrameStatsOverlay()
+#define SUPPORT_FRAME_STATS         1
+// Record trace zones on every thread and save them as Chrome trace JSON file on CloseWindow(): trace.json
+// NOTE: If not defined, trace zones macros are compiled out (module: rtrace)
+//#define SUPPORT_TRACING             1
+// Track raylib allocations by call site: frame allocations, live/peak memory by module, frame allocations guard
+// NOTE: Memory statistics are shown on CloseWindow() (module: utils)
+//#define SUPPORT_MEMORY_TRACKING     1
+// Transient allocations freed inside the frame use a linear arena, reset on EndDrawing()
+// NOTE: Only used by window thread, allocations that do not fit fallback to RL_MALLOC() (module: utils)
+#define SUPPORT_FRAME_ARENA         1
 // Allow scale all the drawn content to match the high-DPI equivalent size (only PLATFORM_DESKTOP)
 //#define SUPPORT_HIGH_DPI            1
 // Support CompressData() and DecompressData() functions
@@ -66,6 +84,9 @@
 //------------------------------------------------------------------------------------
 // Support VR simulation functionality (stereo rendering)
 #define SUPPORT_VR_SIMULATOR        1
+// Use an interleaved compact 2D vertex format for the internal batch (XY float, UV uint16, RGBA8 in one buffer)
+// NOTE: Vertex Z is not stored and texcoords are clamped to [0..1], only useful for 2D-only drawing
+//#define SUPPORT_BATCH_INTERLEAVED_2D 1
 
 
 //------------------------------------------------------------------------------------
@@ -113,6 +134,8 @@
 // Selected desired font fileformats to be supported for loading
 #define SUPPORT_FILEFORMAT_FNT      1
 #define SUPPORT_FILEFORMAT_TTF      1
+// Cache positioned glyph quads of drawn/measured text strings, repeated strings are drawn copying prebuilt vertices
+#define SUPPORT_TEXT_LAYOUT_CACHE   1
 
 
 //------------------------------------------------------------------------------------
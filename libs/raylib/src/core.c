@@ -73,6 +73,26 @@
 *   #define SUPPORT_GIF_RECORDING
 *       Allow automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback()
 *
+*   #define SUPPORT_ASYNC_SCREEN_CAPTURE
+*       Screenshots and gif frames are read asynchronously (pixel buffer objects) and encoded on a
+*       worker thread, so capturing does not stall the game loop (only OpenGL 3.3 and POSIX threads)
+*
+*   #define SUPPORT_VIDEO_RECORDING
+*       Allow recording every frame drawn as raw video (RGBA or Y4M) into a file or a pipe,
+*       BeginVideoRecording()/EndVideoRecording(), requires SUPPORT_ASYNC_SCREEN_CAPTURE
+*
+*   #define SUPPORT_FRAME_STATS
+*       Keep a rolling window of frame time breakdowns (update, draw, swap, poll, wait) for GetFrameStats(),
+*       frame time graph overlay can be drawn on EndDrawing(), ToggleFrameStatsOverlay()
+*
+*   #define SUPPORT_TRACING
+*       Record trace zones (frame phases, batch draws, asset loading, audio mixing) on every thread,
+*       saved as Chrome trace JSON file (chrome://tracing, Perfetto) on CloseWindow()
+*
+*   #define SUPPORT_FRAME_ARENA
+*       Transient allocations done and freed inside a frame (screen reads, music stream decoding, image drawing)
+*       use a linear arena reset on EndDrawing(), instead of the system allocator
+*
 *   #define SUPPORT_HIGH_DPI
 *       Allow scale all the drawn content to match the high-DPI equivalent size (only PLATFORM_DESKTOP)
 *       NOTE: This flag is forced on macOS, since most displays are high-DPI
@@ -127,10 +147,17 @@
 #define RAYMATH_IMPLEMENTATION  // Define external out-of-line implementation of raymath here
 #include "raymath.h"            // Required for: Vector3 and Matrix functions
 
+// NOTE: Included before rlgl.h implementation, so rlgl allocations are tracked [Only if SUPPORT_MEMORY_TRACKING]
+#include "utils.h"              // Required for: fopen() Android mapping, RL_MALLOC() tracking
+
 #define RLGL_IMPLEMENTATION
 #include "rlgl.h"               // raylib OpenGL abstraction layer to OpenGL 1.1, 3.3+ or ES2
 
-#include "utils.h"              // Required for: fopen() Android mapping
+// NOTE: Included after rlgl.h, it already includes rtrace.h in header only mode
+#if defined(SUPPORT_TRACING)
+    #define RTRACE_IMPLEMENTATION
+#endif
+#include "rtrace.h"             // Trace zones saved as Chrome trace events: TRACE_ZONE_BEGIN(), TRACE_ZONE_END()
 
 #if defined(SUPPORT_GESTURES_SYSTEM)
     #define GESTURES_IMPLEMENTATION
@@ -143,10 +170,27 @@
 #endif
 
 #if defined(SUPPORT_GIF_RECORDING)
+    #define RGIF_MALLOC(size) RL_MALLOC(size)
+    #define RGIF_FREE(ptr) RL_FREE(ptr)
+
     #define RGIF_IMPLEMENTATION
     #include "external/rgif.h"  // Support GIF recording
 #endif
 
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+    // NOTE: Asynchronous capture requires pixel buffer objects and fences (OpenGL 3.3) and POSIX threads
+    #if (defined(SUPPORT_SCREEN_CAPTURE) || defined(SUPPORT_GIF_RECORDING) || defined(SUPPORT_VIDEO_RECORDING)) && \
+        defined(PLATFORM_DESKTOP) && defined(GRAPHICS_API_OPENGL_33) && !defined(_MSC_VER)
+        #include <pthread.h>    // POSIX threads management (capture encoding worker)
+    #else
+        #undef SUPPORT_ASYNC_SCREEN_CAPTURE
+    #endif
+#endif
+
+#if defined(SUPPORT_VIDEO_RECORDING) && !defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+    #undef SUPPORT_VIDEO_RECORDING      // NOTE: Video frames are only read and written asynchronously
+#endif
+
 #if defined(__APPLE__)
     #define SUPPORT_HIGH_DPI    // Force HighDPI support on macOS
 #endif
@@ -208,6 +252,17 @@
         //#define GLFW_EXPOSE_NATIVE_COCOA      // WARNING: Fails due to type redefinition
         #include <GLFW/glfw3native.h>   // Required for: glfwGetCocoaWindow()
     #endif
+
+    // NOTE: Headless mode: GLFW null platform (_GLFW_OSMESA), no display required,
+    // rendering context is an EGL surfaceless pbuffer (or an OSMesa context created by GLFW)
+    #if defined(_GLFW_OSMESA)
+        #define PLATFORM_DESKTOP_HEADLESS
+
+        #define EGL_NO_X11                  // Avoid X11 headers inclusion by eglplatform.h
+        #define MESA_EGL_NO_X11_HEADERS     // Same as EGL_NO_X11, for older Mesa versions
+        #include <EGL/egl.h>                // Khronos EGL library - Offscreen context creation
+        #include <EGL/eglext.h>             // Required for: EGL_PLATFORM_SURFACELESS_MESA
+    #endif
 #endif
 
 #if defined(__linux__)
@@ -266,6 +321,14 @@
     char *stbi_zlib_decode_malloc(char const *buffer, int len, int *outlen);
 #endif
 
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE) && defined(SUPPORT_SCREEN_CAPTURE) && defined(SUPPORT_IMAGE_EXPORT)
+    // NOTE: Those declarations require stb_image_write definitions, included in textures module
+    int stbi_write_png(char const *filename, int w, int h, int comp, const void *data, int stride_in_bytes);
+    int stbi_write_bmp(char const *filename, int w, int h, int comp, const void *data);
+    int stbi_write_tga(char const *filename, int w, int h, int comp, const void *data);
+    int stbi_write_jpg(char const *filename, int x, int y, int comp, const void *data, int quality);
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -293,6 +356,18 @@
 
 #define STORAGE_FILENAME        "storage.data"
 
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+    #define MAX_CAPTURE_JOBS          16        // Max number of capture jobs waiting for the encoding worker
+#endif
+
+#if defined(SUPPORT_FRAME_STATS)
+    #define FRAME_STATS_HISTORY      120        // Number of frames in frame stats rolling window
+#endif
+
+#if defined(SUPPORT_TRACING)
+    #define TRACE_OUTPUT_FILE     "trace.json"  // Trace events file saved on CloseWindow()
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -317,6 +392,43 @@ typedef struct{
 } KeyEventFifo;
 #endif
 
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+// Screen capture job type
+typedef enum {
+    CAPTURE_SCREENSHOT = 0,     // Save pixels as image file
+    CAPTURE_GIF_BEGIN,          // Begin gif file
+    CAPTURE_GIF_FRAME,          // Add pixels as gif frame
+    CAPTURE_GIF_END,            // End gif file
+    CAPTURE_VIDEO_BEGIN,        // Begin video stream (write header)
+    CAPTURE_VIDEO_FRAME,        // Add pixels as video frame
+    CAPTURE_VIDEO_END,          // End video stream (close file or pipe)
+    CAPTURE_QUIT                // Close worker thread
+} CaptureJobType;
+
+// Screenshot file format, selected on main thread (file extension check is not thread-safe)
+typedef enum {
+    CAPTURE_FILE_UNKNOWN = 0,   // Not supported by the worker, exported on main thread
+    CAPTURE_FILE_PNG,
+    CAPTURE_FILE_BMP,
+    CAPTURE_FILE_TGA,
+    CAPTURE_FILE_JPG
+} CaptureFileFormat;
+
+// Screen capture job, processed in order by the capture worker thread
+typedef struct CaptureJob {
+    int type;                   // Job type (CaptureJobType)
+    unsigned char *data;        // Pixels data (RGBA), freed by the worker
+    int width;                  // Pixels data width
+    int height;                 // Pixels data height
+    int delay;                  // Delay between gif frames (CAPTURE_GIF_BEGIN)
+    char fileName[512];         // Output file path (CAPTURE_SCREENSHOT, CAPTURE_GIF_BEGIN)
+    FILE *stream;               // Output stream, file or pipe (CAPTURE_VIDEO_BEGIN)
+    bool pipe;                  // Output stream is a pipe (CAPTURE_VIDEO_BEGIN)
+    int format;                 // Screenshot file format (CaptureFileFormat) or video format (VideoFormat)
+    int fps;                    // Video frame rate (CAPTURE_VIDEO_BEGIN)
+} CaptureJob;
+#endif
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -326,6 +438,11 @@ typedef struct{
 #if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
 static GLFWwindow *window;                      // Native window (graphic device)
 #endif
+#if defined(PLATFORM_DESKTOP_HEADLESS)
+static EGLDisplay headlessDisplay = EGL_NO_DISPLAY; // Headless EGL display (surfaceless platform)
+static EGLSurface headlessSurface = EGL_NO_SURFACE; // Headless offscreen surface (pbuffer)
+static EGLContext headlessContext = EGL_NO_CONTEXT; // Headless graphic context (EGL_NO_CONTEXT if OSMesa used)
+#endif
 #if defined(PLATFORM_RPI)
 static EGL_DISPMANX_WINDOW_T window;            // Native window (graphic device)
 #endif
@@ -436,6 +553,12 @@ static double updateTime = 0.0;             // Time measure for frame update
 static double drawTime = 0.0;               // Time measure for frame draw
 static double frameTime = 0.0;              // Time measure for one frame
 static double targetTime = 0.0;             // Desired time for one frame, if 0 not applied
+#if defined(SUPPORT_FRAME_STATS)
+static FrameTiming frameHistory[FRAME_STATS_HISTORY] = { 0 };   // Frame timings rolling window (ring)
+static int frameHistoryFirst = 0;           // Oldest frame timing in window
+static int frameHistoryCounter = 0;         // Number of frame timings in window
+static bool frameStatsOverlay = false;      // Draw frame time graph overlay on EndDrawing()
+#endif
 //-----------------------------------------------------------------------------------
 
 // Config internal variables
@@ -456,6 +579,26 @@ static int screenshotCounter = 0;           // Screenshots counter
 static int gifFramesCounter = 0;            // GIF frames counter
 static bool gifRecording = false;           // GIF recording state
 #endif
+
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+static pthread_t captureThread;             // Capture encoding worker thread
+static pthread_mutex_t captureMutex;        // Capture jobs queue access mutex
+static pthread_cond_t captureCond;          // Capture jobs queue condition (job added or removed)
+static bool captureThreadReady = false;     // Check if capture worker thread has been initialized
+
+static CaptureJob captureJobs[MAX_CAPTURE_JOBS] = { 0 };        // Capture jobs waiting for the worker (ring)
+static int captureJobsFirst = 0;            // Oldest capture job waiting for the worker
+static int captureJobsCounter = 0;          // Number of capture jobs waiting for the worker
+
+static CaptureJob captureReadbacks[MAX_SCREEN_READBACKS] = { 0 };  // Capture jobs waiting for their pixels (ring)
+static int captureReadbacksFirst = 0;       // Oldest capture job waiting for its pixels
+static int captureReadbacksCounter = 0;     // Number of capture jobs waiting for their pixels
+#endif
+
+#if defined(SUPPORT_VIDEO_RECORDING)
+static bool videoRecording = false;         // Video recording state
+static VideoRecordingStats videoStats = { 0 };  // Video recording statistics (framesWritten updated by worker)
+#endif
 //-----------------------------------------------------------------------------------
 
 //----------------------------------------------------------------------------------
@@ -470,10 +613,28 @@ extern void UnloadFontDefault(void);        // [Module: text] Unloads default fo
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static bool InitGraphicsDevice(int width, int height);  // Initialize graphics device
+#if defined(PLATFORM_DESKTOP_HEADLESS)
+static bool InitHeadlessContext(int width, int height); // Initialize headless context (EGL surfaceless)
+static void CloseHeadlessContext(void);                 // Close headless context
+#endif
 static void SetupFramebuffer(int width, int height);    // Setup main framebuffer
 static void SetupViewport(int width, int height);       // Set viewport for a provided width and height
 static void SwapBuffers(void);                          // Copy back buffer to front buffers
 
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+static void QueueScreenCapture(CaptureJob job, int width, int height);  // Queue screen pixels read for a capture job
+static void UpdateScreenCapture(bool wait);             // Send capture jobs with pixels read to the worker
+static bool PushCaptureJob(CaptureJob job);             // Add capture job to the worker queue (blocks if full)
+static void CloseScreenCapture(void);                   // Finish pending captures and close the worker thread
+static void *CaptureThread(void *arg);                  // Capture encoding worker thread
+#endif
+#if defined(SUPPORT_FRAME_STATS)
+static void DrawFrameStatsOverlay(void);                // Draw frame time graph overlay
+#endif
+#if defined(SUPPORT_VIDEO_RECORDING)
+static void WriteVideoFrame(FILE *stream, int format, unsigned char *data, int width, int height);  // Write video frame (worker thread)
+#endif
+
 static void InitTimer(void);                            // Initialize timer
 static void Wait(float ms);                             // Wait for some milliseconds (stop program execution)
 
@@ -608,6 +769,12 @@ void InitWindow(int width, int height, const char *title)
 {
     TraceLog(LOG_INFO, "Initializing raylib %s", RAYLIB_VERSION);
 
+    TRACE_THREAD_NAME("main");
+
+#if defined(SUPPORT_FRAME_ARENA)
+    InitFrameArena();   // NOTE: Arena transient allocations are only used by window thread
+#endif
+
     windowTitle = title;
 #if defined(PLATFORM_ANDROID)
     screenWidth = width;
@@ -721,11 +888,24 @@ void CloseWindow(void)
 #if defined(SUPPORT_GIF_RECORDING)
     if (gifRecording)
     {
+    #if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+        UpdateScreenCapture(true);  // Send all pending gif frames before ending it
+        PushCaptureJob((CaptureJob){ .type = CAPTURE_GIF_END });
+    #else
         GifEnd();
+    #endif
         gifRecording = false;
     }
 #endif
 
+#if defined(SUPPORT_VIDEO_RECORDING)
+    if (videoRecording) EndVideoRecording();
+#endif
+
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+    CloseScreenCapture();       // NOTE: Pending captures are saved before rlgl unloads its buffers
+#endif
+
 #if defined(SUPPORT_DEFAULT_FONT)
     UnloadFontDefault();
 #endif
@@ -737,6 +917,10 @@ void CloseWindow(void)
     glfwTerminate();
 #endif
 
+#if defined(PLATFORM_DESKTOP_HEADLESS)
+    CloseHeadlessContext();
+#endif
+
 #if !defined(SUPPORT_BUSY_WAIT_LOOP) && defined(_WIN32)
     timeEndPeriod(1);           // Restore time period
 #endif
@@ -782,6 +966,19 @@ void CloseWindow(void)
     if (gamepadThreadId) pthread_join(gamepadThreadId, NULL);
 #endif
 
+#if defined(SUPPORT_TRACING)
+    if (SaveTraceFile(TRACE_OUTPUT_FILE)) TraceLog(LOG_INFO, "Trace events saved: %s", TRACE_OUTPUT_FILE);
+    else TraceLog(LOG_WARNING, "[%s] Trace events could not be saved", TRACE_OUTPUT_FILE);
+#endif
+
+#if defined(SUPPORT_FRAME_ARENA)
+    CloseFrameArena();
+#endif
+
+#if defined(SUPPORT_MEMORY_TRACKING)
+    TraceMemoryStats();         // NOTE: Allocations still live are usually leaks (audio device could be still open)
+#endif
+
     TraceLog(LOG_INFO, "Window closed successfully");
 }
 
@@ -1213,6 +1410,9 @@ void ClearBackground(Color color)
 // Setup canvas (framebuffer) to start drawing
 void BeginDrawing(void)
 {
+    TRACE_ZONE_END();                   // Update zone, begun on EndDrawing()
+    TRACE_ZONE_BEGIN("Drawing");
+
     currentTime = GetTime();            // Number of elapsed seconds since InitTimer()
     updateTime = currentTime - previousTime;
     previousTime = currentTime;
@@ -1233,7 +1433,22 @@ void EndDrawing(void)
     DrawRectangle(mousePosition.x, mousePosition.y, 3, 3, MAROON);
 #endif
 
-    rlglDraw();                     // Draw Buffers (Only OpenGL 3+ and ES2)
+    rlglDrawEx(RL_FLUSH_END_FRAME); // Draw Buffers (Only OpenGL 3+ and ES2)
+
+#if defined(SUPPORT_VIDEO_RECORDING)
+    if (videoRecording)
+    {
+        // NOTE: Every frame is read asynchronously, game loop only blocks if capture queues are full
+        QueueScreenCapture((CaptureJob){ .type = CAPTURE_VIDEO_FRAME }, renderWidth, renderHeight);
+        videoStats.framesCaptured++;
+
+        pthread_mutex_lock(&captureMutex);
+        int queueLength = videoStats.framesCaptured - videoStats.framesWritten;
+        pthread_mutex_unlock(&captureMutex);
+
+        if (queueLength > videoStats.maxQueueLength) videoStats.maxQueueLength = queueLength;
+    }
+#endif
 
 #if defined(SUPPORT_GIF_RECORDING)
 
@@ -1246,12 +1461,17 @@ void EndDrawing(void)
         // NOTE: We record one gif frame every 10 game frames
         if ((gifFramesCounter%GIF_RECORD_FRAMERATE) == 0)
         {
+        #if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+            // NOTE: Frame pixels are read asynchronously and encoded on the capture worker thread
+            QueueScreenCapture((CaptureJob){ .type = CAPTURE_GIF_FRAME }, screenWidth, screenHeight);
+        #else
             // Get image data for the current frame (from backbuffer)
             // NOTE: This process is very slow... :(
             unsigned char *screenData = rlReadScreenPixels(screenWidth, screenHeight);
             GifWriteFrame(screenData, screenWidth, screenHeight, 10, 8, false);
 
             RL_FREE(screenData);   // Free image data
+        #endif
         }
 
         if (((gifFramesCounter/15)%2) == 1)
@@ -1264,37 +1484,80 @@ void EndDrawing(void)
     }
 #endif
 
+#if defined(SUPPORT_FRAME_STATS)
+    // NOTE: Overlay is drawn after screen capture requests, so it is not recorded
+    if (frameStatsOverlay) DrawFrameStatsOverlay();
+#endif
+
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+    UpdateScreenCapture(false);     // Send completed screen reads to capture worker (no wait)
+#endif
+
+    rlUpdateRenderStats();          // Close frame render statistics (all frame draws flushed)
+    rlUpdateGpuTimes();             // Close frame GPU timing, read back delayed frames (no wait)
+    UpdateMemoryStats();            // Close frame memory allocations statistics
+#if defined(SUPPORT_FRAME_ARENA)
+    ResetFrameArena();              // Release frame transient allocations
+#endif
+
+    FrameTiming timing = { 0 };     // Frame time breakdown
+    timing.update = (float)updateTime;
+
+    double swapStartTime = GetTime();
+    timing.draw = (float)(swapStartTime - previousTime);    // NOTE: previousTime set on BeginDrawing()
+    TRACE_ZONE_END();               // Drawing zone, begun on BeginDrawing()
+
+    TRACE_ZONE_BEGIN("SwapBuffers");
     SwapBuffers();                  // Copy back buffer to front buffer
+    TRACE_ZONE_END();
+
+    double pollStartTime = GetTime();
+    timing.swap = (float)(pollStartTime - swapStartTime);
+
+    TRACE_ZONE_BEGIN("PollInputEvents");
     PollInputEvents();              // Poll user events
-    
+    TRACE_ZONE_END();
+
     // Frame time control system
     currentTime = GetTime();
+    timing.poll = (float)(currentTime - pollStartTime);
     drawTime = currentTime - previousTime;
     previousTime = currentTime;
 
     frameTime = updateTime + drawTime;
-    
+
     // Wait for some milliseconds...
     if (frameTime < targetTime)
     {
+        TRACE_ZONE_BEGIN("Wait");
         Wait((float)(targetTime - frameTime)*1000.0f);
+        TRACE_ZONE_END();
 
         currentTime = GetTime();
         double waitTime = currentTime - previousTime;
         previousTime = currentTime;
 
         frameTime += waitTime;      // Total frame time: update + draw + wait
-        
-        //SetWindowTitle(FormatText("Update: %f, Draw: %f, Req.Wait: %f, Real.Wait: %f, Total: %f, Target: %f\n", 
-        //               (float)updateTime, (float)drawTime, (float)(targetTime - (updateTime + drawTime)), 
-        //               (float)waitTime, (float)frameTime, (float)targetTime));
+        timing.wait = (float)waitTime;
     }
+
+    timing.total = (float)frameTime;
+
+#if defined(SUPPORT_FRAME_STATS)
+    // Store frame time breakdown in rolling window
+    frameHistory[(frameHistoryFirst + frameHistoryCounter)%FRAME_STATS_HISTORY] = timing;
+
+    if (frameHistoryCounter < FRAME_STATS_HISTORY) frameHistoryCounter++;
+    else frameHistoryFirst = (frameHistoryFirst + 1)%FRAME_STATS_HISTORY;
+#endif
+
+    TRACE_ZONE_BEGIN("Update");     // NOTE: Ended on next BeginDrawing()
 }
 
 // Initialize 2D mode with custom camera (2D)
 void BeginMode2D(Camera2D camera)
 {
-    rlglDraw();                         // Draw Buffers (Only OpenGL 3+ and ES2)
+    rlglDrawEx(RL_FLUSH_MATRIX);        // Draw Buffers (Only OpenGL 3+ and ES2)
 
     rlLoadIdentity();                   // Reset current matrix (MODELVIEW)
 
@@ -1308,7 +1571,7 @@ void BeginMode2D(Camera2D camera)
 // Ends 2D mode with custom camera
 void EndMode2D(void)
 {
-    rlglDraw();                         // Draw Buffers (Only OpenGL 3+ and ES2)
+    rlglDrawEx(RL_FLUSH_MATRIX);        // Draw Buffers (Only OpenGL 3+ and ES2)
 
     rlLoadIdentity();                   // Reset current matrix (MODELVIEW)
     rlMultMatrixf(MatrixToFloat(screenScaling)); // Apply screen scaling if required
@@ -1317,7 +1580,8 @@ void EndMode2D(void)
 // Initializes 3D mode with custom camera (3D)
 void BeginMode3D(Camera3D camera)
 {
-    rlglDraw();                         // Draw Buffers (Only OpenGL 3+ and ES2)
+    rlglDrawEx(RL_FLUSH_MATRIX);        // Draw Buffers (Only OpenGL 3+ and ES2)
+    rlBeginGpuPass("mode3d");           // Begin 3D mode GPU timing
 
     rlMatrixMode(RL_PROJECTION);        // Switch to projection matrix
     rlPushMatrix();                     // Save previous matrix, which contains the settings for the 2d ortho projection
@@ -1357,7 +1621,8 @@ void BeginMode3D(Camera3D camera)
 // Ends 3D mode and returns to default 2D orthographic mode
 void EndMode3D(void)
 {
-    rlglDraw();                         // Process internal buffers (update + draw)
+    rlglDrawEx(RL_FLUSH_MATRIX);        // Process internal buffers (update + draw)
+    rlEndGpuPass();                     // End 3D mode GPU timing
 
     rlMatrixMode(RL_PROJECTION);        // Switch to projection matrix
     rlPopMatrix();                      // Restore previous matrix (PROJECTION) from matrix stack
@@ -1374,6 +1639,7 @@ void EndMode3D(void)
 void BeginTextureMode(RenderTexture2D target)
 {
     rlglDraw();                         // Draw Buffers (Only OpenGL 3+ and ES2)
+    rlBeginGpuPass("texture");          // Begin render texture GPU timing
 
     rlEnableRenderTexture(target.id);   // Enable render target
 
@@ -1402,6 +1668,7 @@ void BeginTextureMode(RenderTexture2D target)
 void EndTextureMode(void)
 {
     rlglDraw();                         // Draw Buffers (Only OpenGL 3+ and ES2)
+    rlEndGpuPass();                     // End render texture GPU timing
 
     rlDisableRenderTexture();           // Disable render target
 
@@ -1600,6 +1867,65 @@ float GetFrameTime(void)
     return (float)frameTime;
 }
 
+#if defined(SUPPORT_FRAME_STATS)
+// Compare two float values (qsort callback)
+static int CompareFloat(const void *a, const void *b)
+{
+    float fa = *(const float *)a;
+    float fb = *(const float *)b;
+
+    return (fa > fb) - (fa < fb);
+}
+#endif
+
+// Returns frame time breakdown statistics (rolling window)
+// NOTE: FrameTiming is processed as an array of floats, one value per time component
+FrameStats GetFrameStats(void)
+{
+    FrameStats stats = { 0 };
+
+#if defined(SUPPORT_FRAME_STATS)
+    #define FRAME_TIMING_VALUES     (int)(sizeof(FrameTiming)/sizeof(float))
+
+    if (frameHistoryCounter == 0) return stats;
+
+    float values[FRAME_STATS_HISTORY] = { 0 };
+    int p99Index = (frameHistoryCounter*99 + 99)/100 - 1;   // Nearest-rank percentile
+
+    stats.frameCount = frameHistoryCounter;
+    stats.last = frameHistory[(frameHistoryFirst + frameHistoryCounter - 1)%FRAME_STATS_HISTORY];
+
+    for (int v = 0; v < FRAME_TIMING_VALUES; v++)
+    {
+        float sum = 0.0f;
+
+        for (int i = 0; i < frameHistoryCounter; i++)
+        {
+            values[i] = ((float *)&frameHistory[(frameHistoryFirst + i)%FRAME_STATS_HISTORY])[v];
+            sum += values[i];
+        }
+
+        qsort(values, frameHistoryCounter, sizeof(float), CompareFloat);
+
+        ((float *)&stats.min)[v] = values[0];
+        ((float *)&stats.avg)[v] = sum/frameHistoryCounter;
+        ((float *)&stats.p99)[v] = values[p99Index];
+    }
+#endif
+
+    return stats;
+}
+
+// Toggle frame time graph overlay (drawn on EndDrawing())
+void ToggleFrameStatsOverlay(void)
+{
+#if defined(SUPPORT_FRAME_STATS)
+    frameStatsOverlay = !frameStatsOverlay;
+#else
+    TraceLog(LOG_WARNING, "Frame stats not supported");
+#endif
+}
+
 // Get elapsed time measure in seconds since InitTimer()
 // NOTE: On PLATFORM_DESKTOP InitTimer() is called on InitWindow()
 // NOTE: On PLATFORM_DESKTOP, timer is initialized on glfwInit()
@@ -1793,9 +2119,6 @@ void SetConfigFlags(unsigned int flags)
 // have their own internal file-systems, to dowload image to user file-system some additional mechanism is required
 void TakeScreenshot(const char *fileName)
 {
-    unsigned char *imgData = rlReadScreenPixels(renderWidth, renderHeight);
-    Image image = { imgData, renderWidth, renderHeight, 1, UNCOMPRESSED_R8G8B8A8 };
-
     char path[512] = { 0 };
 #if defined(PLATFORM_ANDROID)
     strcpy(path, internalDataPath);
@@ -1805,6 +2128,38 @@ void TakeScreenshot(const char *fileName)
     strcpy(path, fileName);
 #endif
 
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+    // NOTE: Screen pixels are read asynchronously and image is saved by the capture worker thread,
+    // file is written some frames later (all pending screenshots are saved on CloseWindow())
+    CaptureJob job = { .type = CAPTURE_SCREENSHOT, .format = CAPTURE_FILE_UNKNOWN };
+    snprintf(job.fileName, sizeof(job.fileName), "%s", path);
+
+#if defined(SUPPORT_IMAGE_EXPORT)
+#if defined(SUPPORT_FILEFORMAT_PNG)
+    if (IsFileExtension(path, ".png")) job.format = CAPTURE_FILE_PNG;
+#endif
+#if defined(SUPPORT_FILEFORMAT_BMP)
+    if (IsFileExtension(path, ".bmp")) job.format = CAPTURE_FILE_BMP;
+#endif
+#if defined(SUPPORT_FILEFORMAT_TGA)
+    if (IsFileExtension(path, ".tga")) job.format = CAPTURE_FILE_TGA;
+#endif
+#if defined(SUPPORT_FILEFORMAT_JPG)
+    if (IsFileExtension(path, ".jpg")) job.format = CAPTURE_FILE_JPG;
+#endif
+#endif
+
+    // Other file formats are exported synchronously with ExportImage()
+    if (job.format != CAPTURE_FILE_UNKNOWN)
+    {
+        QueueScreenCapture(job, renderWidth, renderHeight);
+        return;
+    }
+#endif
+
+    unsigned char *imgData = rlReadScreenPixels(renderWidth, renderHeight);
+    Image image = { imgData, renderWidth, renderHeight, 1, UNCOMPRESSED_R8G8B8A8 };
+
     ExportImage(image, path);
     RL_FREE(imgData);
 
@@ -1817,6 +2172,101 @@ void TakeScreenshot(const char *fileName)
     TraceLog(LOG_INFO, "Screenshot taken: %s", path);
 }
 
+// Begin recording every frame drawn as raw video
+// NOTE: fileName starting with '|' is run as a command receiving the video on its standard input,
+// i.e. "|ffmpeg -y -i - -c:v libx264 -crf 0 replay.mkv" (Y4M format) for lossless encoding
+bool BeginVideoRecording(const char *fileName, int format, int fps)
+{
+#if defined(SUPPORT_VIDEO_RECORDING)
+    if (videoRecording) EndVideoRecording();
+
+    if ((format == VIDEO_FORMAT_Y4M) && (((renderWidth%2) != 0) || ((renderHeight%2) != 0)))
+    {
+        TraceLog(LOG_WARNING, "VIDEO: Y4M format (YUV420) requires even screen size: %i x %i", renderWidth, renderHeight);
+        return false;
+    }
+
+    CaptureJob job = { .type = CAPTURE_VIDEO_BEGIN, .width = renderWidth, .height = renderHeight, .format = format, .fps = (fps > 0)? fps : 60 };
+
+    if (fileName[0] == '|')
+    {
+        job.stream = popen(fileName + 1, "w");
+        job.pipe = true;
+    }
+    else job.stream = fopen(fileName, "wb");
+
+    if (job.stream == NULL)
+    {
+        TraceLog(LOG_WARNING, "VIDEO: [%s] Output could not be opened", fileName);
+        return false;
+    }
+
+    // NOTE: Worker could still be writing frames of a previous recording
+    if (captureThreadReady) pthread_mutex_lock(&captureMutex);
+    memset(&videoStats, 0, sizeof(VideoRecordingStats));
+    if (captureThreadReady) pthread_mutex_unlock(&captureMutex);
+
+    if (!PushCaptureJob(job))
+    {
+        if (job.pipe) pclose(job.stream);
+        else fclose(job.stream);
+
+        TraceLog(LOG_WARNING, "VIDEO: [%s] Recording could not be started", fileName);
+        return false;
+    }
+
+    videoRecording = true;
+
+    TraceLog(LOG_INFO, "VIDEO: [%s] Recording started (%i x %i, %s)", fileName, renderWidth, renderHeight, (format == VIDEO_FORMAT_Y4M)? "Y4M" : "RGBA");
+
+    return true;
+#else
+    TraceLog(LOG_WARNING, "VIDEO: Recording not supported");
+    return false;
+#endif
+}
+
+// End video recording (pending frames are written)
+void EndVideoRecording(void)
+{
+#if defined(SUPPORT_VIDEO_RECORDING)
+    if (!videoRecording) return;
+
+    UpdateScreenCapture(true);      // Send all pending frames before ending the stream
+    PushCaptureJob((CaptureJob){ .type = CAPTURE_VIDEO_END });
+
+    videoRecording = false;
+
+    TraceLog(LOG_INFO, "VIDEO: Recording ended (%i frames, %i stalls, %.3f s stalled)", videoStats.framesCaptured, videoStats.stallCount, videoStats.stallTime);
+#endif
+}
+
+// Check if video is being recorded
+bool IsVideoRecording(void)
+{
+#if defined(SUPPORT_VIDEO_RECORDING)
+    return videoRecording;
+#else
+    return false;
+#endif
+}
+
+// Get video recording statistics (last recording)
+VideoRecordingStats GetVideoRecordingStats(void)
+{
+    VideoRecordingStats stats = { 0 };
+
+#if defined(SUPPORT_VIDEO_RECORDING)
+    if (captureThreadReady) pthread_mutex_lock(&captureMutex);
+    stats = videoStats;
+    if (captureThreadReady) pthread_mutex_unlock(&captureMutex);
+
+    stats.queueLength = stats.framesCaptured - stats.framesWritten;
+#endif
+
+    return stats;
+}
+
 // Check if the file exists
 bool FileExists(const char *fileName)
 {
@@ -2640,7 +3090,18 @@ static bool InitGraphicsDevice(int width, int height)
     }
 
     // NOTE: Getting video modes is not implemented in emscripten GLFW3 version
-#if defined(PLATFORM_DESKTOP)
+#if defined(PLATFORM_DESKTOP_HEADLESS)
+    // NOTE: There is no monitor on headless mode, display is the offscreen framebuffer
+    if ((screenWidth <= 0) || (screenHeight <= 0))
+    {
+        TraceLog(LOG_WARNING, "Headless mode requires a valid screen size");
+        return false;
+    }
+
+    displayWidth = screenWidth;
+    displayHeight = screenHeight;
+    fullscreenMode = false;
+#elif defined(PLATFORM_DESKTOP)
     // Find monitor resolution
     GLFWmonitor *monitor = glfwGetPrimaryMonitor();
     if (!monitor)
@@ -2729,6 +3190,13 @@ static bool InitGraphicsDevice(int width, int height)
 #endif
     }
 
+#if defined(PLATFORM_DESKTOP_HEADLESS)
+    // Try EGL surfaceless context first (hardware accelerated if a GPU is available),
+    // GLFW creates an OSMesa context (software rendering) for the window otherwise
+    if (InitHeadlessContext(screenWidth, screenHeight)) glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+    else glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+#endif
+
     if (fullscreenMode)
     {
         // remember center for switchinging from fullscreen to window
@@ -2832,6 +3300,15 @@ static bool InitGraphicsDevice(int width, int height)
     glfwSetWindowIconifyCallback(window, WindowIconifyCallback);
     glfwSetDropCallback(window, WindowDropCallback);
 
+#if defined(PLATFORM_DESKTOP_HEADLESS)
+    // NOTE: No V-Sync on headless mode, frames are not limited by any display refresh rate
+    if (headlessContext != EGL_NO_CONTEXT) rlLoadExtensions(eglGetProcAddress);
+    else
+    {
+        glfwMakeContextCurrent(window);
+        rlLoadExtensions(glfwGetProcAddress);
+    }
+#else
     glfwMakeContextCurrent(window);
 
 #if !defined(PLATFORM_WEB)
@@ -2852,6 +3329,7 @@ static bool InitGraphicsDevice(int width, int height)
         glfwSwapInterval(1);
         TraceLog(LOG_INFO, "Trying to enable VSYNC");
     }
+#endif // PLATFORM_DESKTOP_HEADLESS
 #endif // PLATFORM_DESKTOP || PLATFORM_WEB
 
 #if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_UWP)
@@ -3852,7 +4330,10 @@ static void PollInputEvents(void)
 // Copy back buffer to front buffers
 static void SwapBuffers(void)
 {
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
+#if defined(PLATFORM_DESKTOP_HEADLESS)
+    if (headlessContext != EGL_NO_CONTEXT) eglSwapBuffers(headlessDisplay, headlessSurface);   // NOTE: No-op for pbuffers
+    else glfwSwapBuffers(window);
+#elif defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
     glfwSwapBuffers(window);
 #endif
 
@@ -3861,6 +4342,457 @@ static void SwapBuffers(void)
 #endif
 }
 
+#if defined(PLATFORM_DESKTOP_HEADLESS)
+// Initialize headless context (EGL surfaceless)
+// NOTE: Rendering goes to an offscreen pbuffer, it works as the default framebuffer (id 0),
+// so render textures and screen reading (rlReadScreenPixels()) work as usual
+static bool InitHeadlessContext(int width, int height)
+{
+    PFNEGLGETPLATFORMDISPLAYEXTPROC eglGetPlatformDisplayEXT = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+
+    if (eglGetPlatformDisplayEXT == NULL)
+    {
+        TraceLog(LOG_WARNING, "HEADLESS: EGL platform display not supported");
+        return false;
+    }
+
+    headlessDisplay = eglGetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+
+    if ((headlessDisplay == EGL_NO_DISPLAY) || (eglInitialize(headlessDisplay, NULL, NULL) == EGL_FALSE))
+    {
+        TraceLog(LOG_WARNING, "HEADLESS: EGL surfaceless display could not be initialized");
+        headlessDisplay = EGL_NO_DISPLAY;
+        return false;
+    }
+
+    bool useES2 = (rlGetVersion() == OPENGL_ES_20);
+
+    const EGLint configAttribs[] =
+    {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, useES2? EGL_OPENGL_ES2_BIT : EGL_OPENGL_BIT,
+        EGL_RED_SIZE, 8,
+        EGL_GREEN_SIZE, 8,
+        EGL_BLUE_SIZE, 8,
+        EGL_ALPHA_SIZE, 8,
+        EGL_DEPTH_SIZE, 24,
+        EGL_SAMPLE_BUFFERS, (configFlags & FLAG_MSAA_4X_HINT)? 1 : 0,
+        EGL_SAMPLES, (configFlags & FLAG_MSAA_4X_HINT)? 4 : 0,
+        EGL_NONE
+    };
+
+    const EGLint pbufferAttribs[] =
+    {
+        EGL_WIDTH, width,
+        EGL_HEIGHT, height,
+        EGL_NONE
+    };
+
+    // NOTE: OpenGL 2.1 and 1.1 get a compatibility profile context
+    const EGLint contextAttribs[] =
+    {
+        EGL_CONTEXT_MAJOR_VERSION, useES2? 2 : ((rlGetVersion() == OPENGL_33)? 3 : 2),
+        EGL_CONTEXT_MINOR_VERSION, useES2? 0 : ((rlGetVersion() == OPENGL_33)? 3 : 1),
+        useES2? EGL_NONE : EGL_CONTEXT_OPENGL_PROFILE_MASK,     // NOTE: Profile only valid for desktop OpenGL
+        (rlGetVersion() == OPENGL_33)? EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT : EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT,
+        EGL_NONE
+    };
+
+    EGLConfig headlessConfig = NULL;
+    EGLint numConfigs = 0;
+
+    if ((eglChooseConfig(headlessDisplay, configAttribs, &headlessConfig, 1, &numConfigs) == EGL_FALSE) || (numConfigs == 0))
+    {
+        TraceLog(LOG_WARNING, "HEADLESS: Failed to get an EGL pbuffer config");
+        CloseHeadlessContext();
+        return false;
+    }
+
+    eglBindAPI(useES2? EGL_OPENGL_ES_API : EGL_OPENGL_API);
+
+    headlessSurface = eglCreatePbufferSurface(headlessDisplay, headlessConfig, pbufferAttribs);
+    headlessContext = eglCreateContext(headlessDisplay, headlessConfig, EGL_NO_CONTEXT, contextAttribs);
+
+    if ((headlessSurface == EGL_NO_SURFACE) || (headlessContext == EGL_NO_CONTEXT) ||
+        (eglMakeCurrent(headlessDisplay, headlessSurface, headlessSurface, headlessContext) == EGL_FALSE))
+    {
+        TraceLog(LOG_WARNING, "HEADLESS: Failed to create EGL offscreen context");
+        CloseHeadlessContext();
+        return false;
+    }
+
+    TraceLog(LOG_INFO, "HEADLESS: EGL surfaceless context initialized successfully (%i x %i)", width, height);
+
+    return true;
+}
+
+// Close headless context
+static void CloseHeadlessContext(void)
+{
+    if (headlessDisplay != EGL_NO_DISPLAY)
+    {
+        eglMakeCurrent(headlessDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+        if (headlessContext != EGL_NO_CONTEXT) eglDestroyContext(headlessDisplay, headlessContext);
+        if (headlessSurface != EGL_NO_SURFACE) eglDestroySurface(headlessDisplay, headlessSurface);
+
+        eglTerminate(headlessDisplay);
+    }
+
+    headlessDisplay = EGL_NO_DISPLAY;
+    headlessSurface = EGL_NO_SURFACE;
+    headlessContext = EGL_NO_CONTEXT;
+}
+#endif
+
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+// Queue screen pixels read for a capture job
+// NOTE: Pixels are read on a pixel buffer object, job is sent to the worker once they are available
+static void QueueScreenCapture(CaptureJob job, int width, int height)
+{
+    // All screen reads in flight, wait for the oldest one
+    if (captureReadbacksCounter == MAX_SCREEN_READBACKS)
+    {
+    #if defined(SUPPORT_VIDEO_RECORDING)
+        double startTime = GetTime();
+        UpdateScreenCapture(true);
+
+        if (videoRecording)
+        {
+            videoStats.stallCount++;
+            videoStats.stallTime += (GetTime() - startTime);
+        }
+    #else
+        UpdateScreenCapture(true);
+    #endif
+    }
+
+    if (rlReadScreenPixelsAsync(width, height))
+    {
+        captureReadbacks[(captureReadbacksFirst + captureReadbacksCounter)%MAX_SCREEN_READBACKS] = job;
+        captureReadbacksCounter++;
+    }
+    else
+    {
+        // Asynchronous read not supported by the OpenGL context, read pixels synchronously
+        job.data = rlReadScreenPixels(width, height);
+        job.width = width;
+        job.height = height;
+
+        PushCaptureJob(job);
+    }
+}
+
+// Send capture jobs with pixels read to the worker
+// NOTE: If wait is true, all pending screen reads are completed (CPU blocks on GPU)
+static void UpdateScreenCapture(bool wait)
+{
+    while (captureReadbacksCounter > 0)
+    {
+        CaptureJob job = captureReadbacks[captureReadbacksFirst];
+
+        job.data = rlGetScreenPixelsAsync(wait, &job.width, &job.height);
+
+        if (job.data == NULL) break;    // Oldest read not completed yet
+
+        captureReadbacksFirst = (captureReadbacksFirst + 1)%MAX_SCREEN_READBACKS;
+        captureReadbacksCounter--;
+
+        PushCaptureJob(job);
+    }
+}
+
+// Add capture job to the worker queue (blocks if full)
+// NOTE: Worker thread is initialized on first job, returns false if it could not be created (job data is freed)
+static bool PushCaptureJob(CaptureJob job)
+{
+    if (!captureThreadReady)
+    {
+        pthread_mutex_init(&captureMutex, NULL);
+        pthread_cond_init(&captureCond, NULL);
+
+        if (pthread_create(&captureThread, NULL, &CaptureThread, NULL) != 0)
+        {
+            TraceLog(LOG_WARNING, "Capture worker thread could not be created");
+
+            pthread_cond_destroy(&captureCond);
+            pthread_mutex_destroy(&captureMutex);
+
+            RL_FREE(job.data);
+            return false;
+        }
+
+        captureThreadReady = true;
+    }
+
+    pthread_mutex_lock(&captureMutex);
+
+    if (captureJobsCounter == MAX_CAPTURE_JOBS)
+    {
+        // Worker is behind, block until it takes a job (backpressure)
+        double startTime = GetTime();
+
+        while (captureJobsCounter == MAX_CAPTURE_JOBS) pthread_cond_wait(&captureCond, &captureMutex);
+
+    #if defined(SUPPORT_VIDEO_RECORDING)
+        if (videoRecording)
+        {
+            videoStats.stallCount++;
+            videoStats.stallTime += (GetTime() - startTime);
+        }
+    #endif
+    }
+
+    captureJobs[(captureJobsFirst + captureJobsCounter)%MAX_CAPTURE_JOBS] = job;
+    captureJobsCounter++;
+
+    pthread_cond_broadcast(&captureCond);
+    pthread_mutex_unlock(&captureMutex);
+
+    return true;
+}
+
+// Finish pending captures and close the worker thread
+static void CloseScreenCapture(void)
+{
+    UpdateScreenCapture(true);
+
+    if (captureThreadReady)
+    {
+        PushCaptureJob((CaptureJob){ .type = CAPTURE_QUIT });
+        pthread_join(captureThread, NULL);
+
+        pthread_cond_destroy(&captureCond);
+        pthread_mutex_destroy(&captureMutex);
+
+        captureThreadReady = false;
+    }
+}
+
+// Capture encoding worker thread
+// NOTE: Jobs are processed in order, gif file is only accessed from this thread
+static void *CaptureThread(void *arg)
+{
+    bool quit = false;
+
+    TRACE_THREAD_NAME("capture");
+
+#if defined(SUPPORT_VIDEO_RECORDING)
+    CaptureJob video = { 0 };       // Current video stream (CAPTURE_VIDEO_BEGIN job)
+#endif
+
+    while (!quit)
+    {
+        pthread_mutex_lock(&captureMutex);
+
+        while (captureJobsCounter == 0) pthread_cond_wait(&captureCond, &captureMutex);
+
+        CaptureJob job = captureJobs[captureJobsFirst];
+        captureJobsFirst = (captureJobsFirst + 1)%MAX_CAPTURE_JOBS;
+        captureJobsCounter--;
+
+        pthread_cond_broadcast(&captureCond);
+        pthread_mutex_unlock(&captureMutex);
+
+        TRACE_ZONE_BEGIN("CaptureJob");
+
+        switch (job.type)
+        {
+        #if defined(SUPPORT_SCREEN_CAPTURE)
+            case CAPTURE_SCREENSHOT:
+            {
+                // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
+                for (int i = 3; i < job.width*job.height*4; i += 4) job.data[i] = 255;
+
+                // NOTE: Encoder is selected on main thread, ExportImage() is not used (file extension check is not thread-safe)
+                int success = 0;
+
+                switch (job.format)
+                {
+                #if defined(SUPPORT_IMAGE_EXPORT)
+                    case CAPTURE_FILE_PNG: success = stbi_write_png(job.fileName, job.width, job.height, 4, job.data, job.width*4); break;
+                    case CAPTURE_FILE_BMP: success = stbi_write_bmp(job.fileName, job.width, job.height, 4, job.data); break;
+                    case CAPTURE_FILE_TGA: success = stbi_write_tga(job.fileName, job.width, job.height, 4, job.data); break;
+                    case CAPTURE_FILE_JPG: success = stbi_write_jpg(job.fileName, job.width, job.height, 4, job.data, 80); break;
+                #endif
+                    default: break;
+                }
+
+                if (success != 0) TraceLog(LOG_INFO, "Screenshot taken: %s", job.fileName);
+                else TraceLog(LOG_WARNING, "Screenshot could not be saved: %s", job.fileName);
+            } break;
+        #endif
+        #if defined(SUPPORT_GIF_RECORDING)
+            case CAPTURE_GIF_BEGIN: GifBegin(job.fileName, job.width, job.height, job.delay, 8, false); break;
+            case CAPTURE_GIF_FRAME: GifWriteFrame(job.data, job.width, job.height, 10, 8, false); break;
+            case CAPTURE_GIF_END: GifEnd(); break;
+        #endif
+        #if defined(SUPPORT_VIDEO_RECORDING)
+            case CAPTURE_VIDEO_BEGIN:
+            {
+                video = job;
+
+                // Frames of previous recording written after stats reset are not counted
+                pthread_mutex_lock(&captureMutex);
+                videoStats.framesWritten = 0;
+                pthread_mutex_unlock(&captureMutex);
+
+                // NOTE: YUV4MPEG2 header, progressive frames, square pixels, JPEG chroma siting (full range)
+                if (video.format == VIDEO_FORMAT_Y4M) fprintf(video.stream, "YUV4MPEG2 W%i H%i F%i:1 Ip A1:1 C420jpeg\n", video.width, video.height, video.fps);
+            } break;
+            case CAPTURE_VIDEO_FRAME:
+            {
+                // NOTE: Frames with a different size than the video (window resized) are skipped
+                if ((video.stream != NULL) && (job.width == video.width) && (job.height == video.height)) WriteVideoFrame(video.stream, video.format, job.data, job.width, job.height);
+
+                pthread_mutex_lock(&captureMutex);
+                videoStats.framesWritten++;
+                pthread_mutex_unlock(&captureMutex);
+            } break;
+            case CAPTURE_VIDEO_END:
+            {
+                if (video.stream != NULL)
+                {
+                    if (video.pipe) pclose(video.stream);
+                    else fclose(video.stream);
+                }
+
+                video.stream = NULL;
+            } break;
+        #endif
+            case CAPTURE_QUIT: quit = true; break;
+            default: break;
+        }
+
+        TRACE_ZONE_END();
+
+        RL_FREE(job.data);
+    }
+
+    return NULL;
+}
+#endif
+
+#if defined(SUPPORT_FRAME_STATS)
+// Draw frame time graph overlay
+// NOTE: One stacked bar by frame in window (oldest on the left), target frame time marked by a red line
+static void DrawFrameStatsOverlay(void)
+{
+    #define FRAME_GRAPH_HEIGHT      100
+
+    const Color colors[5] = { SKYBLUE, LIME, ORANGE, VIOLET, GRAY };
+    const char *names[5] = { "update", "draw", "swap", "poll", "wait" };
+
+    FrameStats stats = GetFrameStats();
+
+    int width = FRAME_STATS_HISTORY*2;
+    int posX = screenWidth - width - 10;
+    int posY = 10;
+
+    // Graph scale: two target frames or 30 fps frame
+    float maxTime = (targetTime > 0.0)? (float)targetTime*2.0f : 1.0f/30.0f;
+
+    DrawRectangle(posX - 5, posY - 5, width + 10, FRAME_GRAPH_HEIGHT + 9*12 + 15, Fade(BLACK, 0.7f));
+
+    for (int i = 0; i < frameHistoryCounter; i++)
+    {
+        const float *timing = (const float *)&frameHistory[(frameHistoryFirst + i)%FRAME_STATS_HISTORY];
+        float bottom = 0.0f;
+
+        for (int v = 0; v < 5; v++)
+        {
+            float top = bottom + timing[v];
+
+            int y0 = (int)(FRAME_GRAPH_HEIGHT*((bottom > maxTime)? 1.0f : bottom/maxTime));
+            int y1 = (int)(FRAME_GRAPH_HEIGHT*((top > maxTime)? 1.0f : top/maxTime));
+
+            if (y1 > y0) DrawRectangle(posX + i*2, posY + FRAME_GRAPH_HEIGHT - y1, 2, y1 - y0, colors[v]);
+
+            bottom = top;
+        }
+    }
+
+    if (targetTime > 0.0) DrawRectangle(posX, posY + FRAME_GRAPH_HEIGHT/2, width, 1, RED);
+
+    for (int v = 0; v < 5; v++)
+    {
+        DrawText(TextFormat("%-6s %5.2f avg %5.2f p99 ms", names[v], ((float *)&stats.avg)[v]*1000.0f, ((float *)&stats.p99)[v]*1000.0f),
+                 posX, posY + FRAME_GRAPH_HEIGHT + 5 + v*12, 10, colors[v]);
+    }
+
+    DrawText(TextFormat("frame  %5.2f avg %5.2f p99 ms", stats.avg.total*1000.0f, stats.p99.total*1000.0f), posX, posY + FRAME_GRAPH_HEIGHT + 5 + 5*12, 10, RAYWHITE);
+
+    // NOTE: Render statistics refer to previous frame (including its overlay)
+    RenderStats render = rlGetRenderStats();
+
+    DrawText(TextFormat("draws %d verts %d flushes %d", render.drawCalls, render.vertexCount, render.flushCount), posX, posY + FRAME_GRAPH_HEIGHT + 5 + 6*12, 10, RAYWHITE);
+    DrawText(TextFormat("binds %d shaders %d upload %.1f KB", render.textureBinds, render.shaderSwitches, render.uploadedBytes/1024.0f), posX, posY + FRAME_GRAPH_HEIGHT + 5 + 7*12, 10, RAYWHITE);
+
+    // NOTE: GPU times are read back some frames later, so CPU never waits for them
+    GpuTimes gpu = rlGetGpuTimes();
+
+    if (gpu.ready) DrawText(TextFormat("gpu    %5.2f ms (%i frames ago)", gpu.frameTime, gpu.frameDelay), posX, posY + FRAME_GRAPH_HEIGHT + 5 + 8*12, 10, RAYWHITE);
+    else DrawText("gpu    not available", posX, posY + FRAME_GRAPH_HEIGHT + 5 + 8*12, 10, RAYWHITE);
+
+    rlglDraw();                     // Draw overlay
+}
+#endif
+
+#if defined(SUPPORT_VIDEO_RECORDING)
+// Write video frame (worker thread)
+// NOTE: Y4M frames are converted to YUV420 full range (BT.601, JPEG), chroma is averaged on 2x2 pixel blocks,
+// video size is checked to be even when recording begins
+static void WriteVideoFrame(FILE *stream, int format, unsigned char *data, int width, int height)
+{
+    if (format == VIDEO_FORMAT_Y4M)
+    {
+        int size = width*height;
+        unsigned char *yuv = (unsigned char *)RL_MALLOC(size + size/2);
+        unsigned char *u = yuv + size;
+        unsigned char *v = u + size/4;
+
+        for (int y = 0; y < height; y += 2)
+        {
+            for (int x = 0; x < width; x += 2)
+            {
+                int r = 0, g = 0, b = 0;
+
+                for (int k = 0; k < 4; k++)
+                {
+                    int i = (y + k/2)*width + (x + k%2);
+                    const unsigned char *pixel = &data[i*4];
+
+                    yuv[i] = (unsigned char)((77*pixel[0] + 150*pixel[1] + 29*pixel[2] + 128) >> 8);
+
+                    r += pixel[0];
+                    g += pixel[1];
+                    b += pixel[2];
+                }
+
+                // NOTE: Sums of 4 pixels, offset of 128 added before shifting to keep values positive
+                int cb = (-43*r - 85*g + 128*b + (128 << 10) + 512) >> 10;
+                int cr = (128*r - 107*g - 21*b + (128 << 10) + 512) >> 10;
+
+                u[(y/2)*(width/2) + x/2] = (unsigned char)((cb > 255)? 255 : ((cb < 0)? 0 : cb));
+                v[(y/2)*(width/2) + x/2] = (unsigned char)((cr > 255)? 255 : ((cr < 0)? 0 : cr));
+            }
+        }
+
+        fwrite("FRAME\n", 1, 6, stream);
+        fwrite(yuv, 1, size + size/2, stream);
+
+        RL_FREE(yuv);
+    }
+    else
+    {
+        // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
+        for (int i = 3; i < width*height*4; i += 4) data[i] = 255;
+
+        fwrite(data, 1, width*height*4, stream);
+    }
+}
+#endif
+
 #if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
 // GLFW3 Error Callback, runs on GLFW3 error
 static void ErrorCallback(int error, const char *description)
@@ -3890,7 +4822,12 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
         {
             if (gifRecording)
             {
+            #if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+                UpdateScreenCapture(true);  // Send all pending gif frames before ending it
+                PushCaptureJob((CaptureJob){ .type = CAPTURE_GIF_END });
+            #else
                 GifEnd();
+            #endif
                 gifRecording = false;
 
             #if defined(PLATFORM_WEB)
@@ -3916,7 +4853,13 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
 
                 // NOTE: delay represents the time between frames in the gif, if we capture a gif frame every
                 // 10 game frames and each frame trakes 16.6ms (60fps), delay between gif frames should be ~16.6*10.
+            #if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+                CaptureJob job = { .type = CAPTURE_GIF_BEGIN, .width = screenWidth, .height = screenHeight, .delay = (int)(GetFrameTime()*10.0f) };
+                snprintf(job.fileName, sizeof(job.fileName), "%s", path);
+                PushCaptureJob(job);
+            #else
                 GifBegin(path, screenWidth, screenHeight, (int)(GetFrameTime()*10.0f), 8, false);
+            #endif
                 screenshotCounter++;
 
                 TraceLog(LOG_INFO, "Begin animated GIF recording: %s", TextFormat("screenrec%03i.gif", screenshotCounter));
@@ -52,7 +52,14 @@
 
 #include "rlgl.h"           // raylib OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2
 
+#include "rtrace.h"         // Required for: TRACE_ZONE_BEGIN(), TRACE_ZONE_END() [Only if SUPPORT_TRACING]
+
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
+    #define TINYOBJ_MALLOC RL_MALLOC
+    #define TINYOBJ_CALLOC RL_CALLOC
+    #define TINYOBJ_REALLOC RL_REALLOC
+    #define TINYOBJ_FREE RL_FREE
+
     #define TINYOBJ_LOADER_C_IMPLEMENTATION
     #include "external/tinyobj_loader_c.h"      // OBJ/MTL file formats loading
 #endif
@@ -64,6 +71,11 @@
 #endif
 
 #if defined(SUPPORT_MESH_GENERATION)
+    #define PAR_MALLOC(T, N) ((T*)RL_MALLOC(N*sizeof(T)))
+    #define PAR_CALLOC(T, N) ((T*)RL_CALLOC(N*sizeof(T), 1))
+    #define PAR_REALLOC(T, BUF, N) ((T*)RL_REALLOC(BUF, sizeof(T)*(N)))
+    #define PAR_FREE(BUF) RL_FREE(BUF)
+
     #define PAR_SHAPES_IMPLEMENTATION
     #include "external/par_shapes.h"    // Shapes 3d parametric generation
 #endif
@@ -647,6 +659,8 @@ void DrawGizmo(Vector3 position)
 // Load model from files (mesh and material)
 Model LoadModel(const char *fileName)
 {
+    TRACE_ZONE_BEGIN("LoadModel");
+
     Model model = { 0 };
 
 #if defined(SUPPORT_FILEFORMAT_OBJ)
@@ -690,6 +704,8 @@ Model LoadModel(const char *fileName)
         if (model.meshMaterial == NULL) model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
     }
 
+    TRACE_ZONE_END();
+
     return model;
 }
 
@@ -3437,10 +3453,10 @@ static Texture LoadTextureFromCgltfImage(cgltf_image *image, const char *texPath
 
         int w, h;
         unsigned char *raw = stbi_load_from_memory(data, image->buffer_view->size, &w, &h, NULL, 4);
-        free(data);
+        RL_FREE(data);
 
         Image rimage = LoadImagePro(raw, w, h, UNCOMPRESSED_R8G8B8A8);
-        free(raw);
+        RL_FREE(raw);
 
         // TODO: Tint shouldn't be applied here!
         ImageColorTint(&rimage, tint);
@@ -3457,6 +3473,20 @@ static Texture LoadTextureFromCgltfImage(cgltf_image *image, const char *texPath
     return texture;
 }
 
+// Allocate glTF data memory (cgltf callback)
+static void *AllocGLTF(void *user, cgltf_size size)
+{
+    (void)user;
+    return RL_MALLOC(size);
+}
+
+// Free glTF data memory (cgltf callback)
+static void FreeGLTF(void *user, void *ptr)
+{
+    (void)user;
+    RL_FREE(ptr);
+}
+
 // Load glTF mesh data
 static Model LoadGLTF(const char *fileName)
 {
@@ -3513,6 +3543,8 @@ static Model LoadGLTF(const char *fileName)
 
     // glTF data loading
     cgltf_options options = { 0 };
+    options.memory_alloc = AllocGLTF;
+    options.memory_free = FreeGLTF;
     cgltf_data *data = NULL;
     cgltf_result result = cgltf_parse(&options, buffer, size, &data);
 
@@ -78,6 +78,13 @@
     #include "utils.h"          // Required for: fopen() Android mapping
 #endif
 
+#include "rtrace.h"             // Required for: TRACE_ZONE_BEGIN(), TRACE_ZONE_END() [Only if SUPPORT_TRACING]
+
+// Route external libraries allocations through raylib allocator
+#define MA_MALLOC(sz)           RL_MALLOC(sz)
+#define MA_REALLOC(p,sz)        RL_REALLOC(p,sz)
+#define MA_FREE(p)              RL_FREE(p)
+
 #define MA_NO_JACK
 #define MINIAUDIO_IMPLEMENTATION
 #include "external/miniaudio.h" // miniaudio library
@@ -86,6 +93,7 @@
 #include <stdlib.h>             // Required for: malloc(), free()
 #include <string.h>             // Required for: strcmp(), strncmp()
 #include <stdio.h>              // Required for: FILE, fopen(), fclose(), fread()
+#include <ctype.h>              // Required for: tolower() [Used in IsFileType()]
 
 #if defined(SUPPORT_FILEFORMAT_OGG)
     #define STB_VORBIS_IMPLEMENTATION
@@ -93,22 +101,36 @@
 #endif
 
 #if defined(SUPPORT_FILEFORMAT_XM)
+    #define JARXM_MALLOC(sz)    RL_MALLOC(sz)
+    #define JARXM_FREE(p)       RL_FREE(p)
+
     #define JAR_XM_IMPLEMENTATION
     #include "external/jar_xm.h"        // XM loading functions
 #endif
 
 #if defined(SUPPORT_FILEFORMAT_MOD)
+    #define JARMOD_MALLOC(sz)   RL_MALLOC(sz)
+    #define JARMOD_FREE(p)      RL_FREE(p)
+
     #define JAR_MOD_IMPLEMENTATION
     #include "external/jar_mod.h"       // MOD loading functions
 #endif
 
 #if defined(SUPPORT_FILEFORMAT_FLAC)
+    #define DRFLAC_MALLOC(sz)   RL_MALLOC(sz)
+    #define DRFLAC_REALLOC(p,sz) RL_REALLOC(p,sz)
+    #define DRFLAC_FREE(p)      RL_FREE(p)
+
     #define DR_FLAC_IMPLEMENTATION
     #define DR_FLAC_NO_WIN32_IO
     #include "external/dr_flac.h"       // FLAC loading functions
 #endif
 
 #if defined(SUPPORT_FILEFORMAT_MP3)
+    #define DRMP3_MALLOC(sz)    RL_MALLOC(sz)
+    #define DRMP3_REALLOC(p,sz) RL_REALLOC(p,sz)
+    #define DRMP3_FREE(p)       RL_FREE(p)
+
     #define DR_MP3_IMPLEMENTATION
     #include "external/dr_mp3.h"        // MP3 loading functions
 #endif
@@ -126,6 +148,14 @@
 // In case of music-stalls, just increase this number
 #define AUDIO_BUFFER_SIZE        4096       // PCM data samples (i.e. 16bit, Mono: 8Kb)
 
+// Transient allocations, freed before the end of the frame (defined by utils.h, frame arena)
+#ifndef RL_FRAME_CALLOC
+    #define RL_FRAME_CALLOC(n,sz)   RL_CALLOC(n,sz)
+#endif
+#ifndef RL_FRAME_FREE
+    #define RL_FRAME_FREE(p)        RL_FREE(p)
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -165,17 +195,22 @@ typedef enum {
 //----------------------------------------------------------------------------------
 #if defined(SUPPORT_FILEFORMAT_WAV)
 static Wave LoadWAV(const char *fileName);              // Load WAV file
+static Wave LoadWAVFromMemory(const unsigned char *fileData, unsigned int dataSize);   // Load WAV from memory buffer
 static int SaveWAV(Wave wave, const char *fileName);    // Save wave data as WAV file
 #endif
 #if defined(SUPPORT_FILEFORMAT_OGG)
 static Wave LoadOGG(const char *fileName);              // Load OGG file
+static Wave LoadOGGFromMemory(const unsigned char *fileData, unsigned int dataSize);   // Load OGG from memory buffer
 #endif
 #if defined(SUPPORT_FILEFORMAT_FLAC)
 static Wave LoadFLAC(const char *fileName);             // Load FLAC file
+static Wave LoadFLACFromMemory(const unsigned char *fileData, unsigned int dataSize);  // Load FLAC from memory buffer
 #endif
 #if defined(SUPPORT_FILEFORMAT_MP3)
 static Wave LoadMP3(const char *fileName);              // Load MP3 file
+static Wave LoadMP3FromMemory(const unsigned char *fileData, unsigned int dataSize);   // Load MP3 from memory buffer
 #endif
+static bool IsFileType(const char *fileType, const char *ext);  // Check memory buffer file type, i.e. ".ogg"
 
 #if defined(RAUDIO_STANDALONE)
 bool IsFileExtension(const char *fileName, const char *ext);    // Check file extension
@@ -276,6 +311,9 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
 {
     (void)pDevice;
 
+    TRACE_THREAD_NAME("audio");
+    TRACE_ZONE_BEGIN("AudioMixing");
+
     // Mixing is basically just an accumulation, we need to initialize the output buffer to 0
     memset(pFramesOut, 0, frameCount*pDevice->playback.channels*ma_get_bytes_per_sample(pDevice->playback.format));
 
@@ -357,6 +395,8 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
     }
 
     ma_mutex_unlock(&audioLock);
+
+    TRACE_ZONE_END();
 }
 
 // DSP read from audio buffer callback function
@@ -786,6 +826,8 @@ void UntrackAudioBuffer(AudioBuffer *buffer)
 // Load wave data from file
 Wave LoadWave(const char *fileName)
 {
+    TRACE_ZONE_BEGIN("LoadWave");
+
     Wave wave = { 0 };
 
     if (false) { }
@@ -803,6 +845,35 @@ Wave LoadWave(const char *fileName)
 #endif
     else TraceLog(LOG_WARNING, "[%s] Audio fileformat not supported, it can't be loaded", fileName);
 
+    TRACE_ZONE_END();
+
+    return wave;
+}
+
+// Load wave data from memory buffer, fileType refers to extension: i.e. ".wav"
+// NOTE: Compressed formats are decoded directly from the provided buffer (no intermediate copy),
+// buffer is owned by the caller and can be freed once this function returns
+Wave LoadWaveFromMemory(const char *fileType, const unsigned char *fileData, int dataSize)
+{
+    Wave wave = { 0 };
+
+    if ((fileData == NULL) || (dataSize <= 0)) TraceLog(LOG_WARNING, "[%s] Audio data provided is not valid", fileType);
+#if defined(SUPPORT_FILEFORMAT_WAV)
+    else if (IsFileType(fileType, ".wav")) wave = LoadWAVFromMemory(fileData, dataSize);
+#endif
+#if defined(SUPPORT_FILEFORMAT_OGG)
+    else if (IsFileType(fileType, ".ogg")) wave = LoadOGGFromMemory(fileData, dataSize);
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+    else if (IsFileType(fileType, ".flac")) wave = LoadFLACFromMemory(fileData, dataSize);
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+    else if (IsFileType(fileType, ".mp3")) wave = LoadMP3FromMemory(fileData, dataSize);
+#endif
+    else TraceLog(LOG_WARNING, "[%s] Audio fileformat not supported, it can't be loaded", fileType);
+
+    if (wave.data != NULL) TraceLog(LOG_INFO, "[%s] Wave loaded successfully from memory (%i Hz, %i bit, %s)", fileType, wave.sampleRate, wave.sampleSize, (wave.channels == 1)? "Mono" : "Stereo");
+
     return wave;
 }
 
@@ -810,12 +881,16 @@ Wave LoadWave(const char *fileName)
 // NOTE: The entire file is loaded to memory to be played (no-streaming)
 Sound LoadSound(const char *fileName)
 {
+    TRACE_ZONE_BEGIN("LoadSound");
+
     Wave wave = LoadWave(fileName);
 
     Sound sound = LoadSoundFromWave(wave);
 
     UnloadWave(wave);       // Sound is loaded, we can unload wave
 
+    TRACE_ZONE_END();
+
     return sound;
 }
 
@@ -1177,6 +1252,8 @@ float *GetWaveData(Wave wave)
 // Load music stream from file
 Music LoadMusicStream(const char *fileName)
 {
+    TRACE_ZONE_BEGIN("LoadMusicStream");
+
     Music music = { 0 };
     bool musicLoaded = false;
 
@@ -1312,6 +1389,159 @@ Music LoadMusicStream(const char *fileName)
         TraceLog(LOG_INFO, "   Channels: %i (%s)", music.stream.channels, (music.stream.channels == 1)? "Mono" : (music.stream.channels == 2)? "Stereo" : "Multi");
     }
 
+    TRACE_ZONE_END();
+
+    return music;
+}
+
+// Load music stream from memory buffer, fileType refers to extension: i.e. ".ogg"
+// NOTE: Data is decoded incrementally from the provided buffer while streaming (no intermediate copy),
+// so buffer must be kept alive (i.e. mapped) until UnloadMusicStream() is called, MOD modules are copied
+Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data, int dataSize)
+{
+    Music music = { 0 };
+    bool musicLoaded = false;
+
+    if ((data == NULL) || (dataSize <= 0)) { }
+#if defined(SUPPORT_FILEFORMAT_OGG)
+    else if (IsFileType(fileType, ".ogg"))
+    {
+        // Open ogg audio stream
+        music.ctxData = stb_vorbis_open_memory(data, dataSize, NULL, NULL);
+
+        if (music.ctxData != NULL)
+        {
+            music.ctxType = MUSIC_AUDIO_OGG;
+            stb_vorbis_info info = stb_vorbis_get_info((stb_vorbis *)music.ctxData);  // Get Ogg file info
+
+            // OGG bit rate defaults to 16 bit, it's enough for compressed format
+            music.stream = InitAudioStream(info.sample_rate, 16, info.channels);
+            music.sampleCount = (unsigned int)stb_vorbis_stream_length_in_samples((stb_vorbis *)music.ctxData)*info.channels;
+            music.loopCount = 0;   // Infinite loop by default
+            musicLoaded = true;
+        }
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+    else if (IsFileType(fileType, ".flac"))
+    {
+        music.ctxData = drflac_open_memory(data, dataSize);
+
+        if (music.ctxData != NULL)
+        {
+            music.ctxType = MUSIC_AUDIO_FLAC;
+            drflac *ctxFlac = (drflac *)music.ctxData;
+
+            music.stream = InitAudioStream(ctxFlac->sampleRate, ctxFlac->bitsPerSample, ctxFlac->channels);
+            music.sampleCount = (unsigned int)ctxFlac->totalSampleCount;
+            music.loopCount = 0;   // Infinite loop by default
+            musicLoaded = true;
+        }
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+    else if (IsFileType(fileType, ".mp3"))
+    {
+        drmp3 *ctxMp3 = RL_MALLOC(sizeof(drmp3));
+        music.ctxData = ctxMp3;
+        music.ctxType = MUSIC_AUDIO_MP3;
+
+        int result = drmp3_init_memory(ctxMp3, data, dataSize, NULL);
+
+        if (result > 0)
+        {
+            music.stream = InitAudioStream(ctxMp3->sampleRate, 32, ctxMp3->channels);
+            music.sampleCount = drmp3_get_pcm_frame_count(ctxMp3)*ctxMp3->channels;
+            music.loopCount = 0;   // Infinite loop by default
+            musicLoaded = true;
+        }
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_XM)
+    else if (IsFileType(fileType, ".xm"))
+    {
+        jar_xm_context_t *ctxXm = NULL;
+
+        // NOTE: XM module is parsed into its own context structures, it does not keep a reference to data
+        int result = jar_xm_create_context_safe(&ctxXm, (const char *)data, dataSize, 48000);
+
+        if (result == 0)    // XM context created successfully
+        {
+            music.ctxType = MUSIC_MODULE_XM;
+            jar_xm_set_max_loop_count(ctxXm, 0);    // Set infinite number of loops
+
+            // NOTE: Only stereo is supported for XM
+            music.stream = InitAudioStream(48000, 16, 2);
+            music.sampleCount = (unsigned int)jar_xm_get_remaining_samples(ctxXm);
+            music.loopCount = 0;   // Infinite loop by default
+            jar_xm_reset(ctxXm);   // make sure we start at the beginning of the song
+            musicLoaded = true;
+
+            music.ctxData = ctxXm;
+        }
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_MOD)
+    else if (IsFileType(fileType, ".mod"))
+    {
+        jar_mod_context_t *ctxMod = RL_MALLOC(sizeof(jar_mod_context_t));
+        music.ctxData = ctxMod;
+        music.ctxType = MUSIC_MODULE_MOD;
+
+        jar_mod_init(ctxMod);
+
+        // NOTE: MOD data is copied and kept in ctxMod->modfile (as jar_mod_load_file() does),
+        // it is required to restart the module on seek (stop/loop) and freed by jar_mod_unload()
+        unsigned char *modData = (dataSize > 0)? (unsigned char *)JARMOD_MALLOC(dataSize) : NULL;
+        if (modData != NULL) memcpy(modData, data, dataSize);
+
+        if ((modData != NULL) && jar_mod_load(ctxMod, modData, dataSize))
+        {
+            ctxMod->modfile = modData;
+            ctxMod->modfilesize = dataSize;
+
+            // NOTE: Only stereo is supported for MOD
+            music.stream = InitAudioStream(48000, 16, 2);
+            music.sampleCount = (unsigned int)jar_mod_max_samples(ctxMod);
+            music.loopCount = 0;   // Infinite loop by default
+            musicLoaded = true;
+        }
+        else JARMOD_FREE(modData);
+    }
+#endif
+
+    if (!musicLoaded)
+    {
+        if (music.ctxData == NULL) { }
+    #if defined(SUPPORT_FILEFORMAT_OGG)
+        else if (music.ctxType == MUSIC_AUDIO_OGG) stb_vorbis_close((stb_vorbis *)music.ctxData);
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_FLAC)
+        else if (music.ctxType == MUSIC_AUDIO_FLAC) drflac_free((drflac *)music.ctxData);
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MP3)
+        else if (music.ctxType == MUSIC_AUDIO_MP3) { drmp3_uninit((drmp3 *)music.ctxData); RL_FREE(music.ctxData); }
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_XM)
+        else if (music.ctxType == MUSIC_MODULE_XM) jar_xm_free_context((jar_xm_context_t *)music.ctxData);
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MOD)
+        else if (music.ctxType == MUSIC_MODULE_MOD) { jar_mod_unload((jar_mod_context_t *)music.ctxData); RL_FREE(music.ctxData); }
+    #endif
+
+        music.ctxData = NULL;
+        TraceLog(LOG_WARNING, "[%s] Music data could not be opened from memory", fileType);
+    }
+    else
+    {
+        // Show some music stream info
+        TraceLog(LOG_INFO, "[%s] Music data successfully loaded from memory:", fileType);
+        TraceLog(LOG_INFO, "   Total samples: %i", music.sampleCount);
+        TraceLog(LOG_INFO, "   Sample rate: %i Hz", music.stream.sampleRate);
+        TraceLog(LOG_INFO, "   Sample size: %i bits", music.stream.sampleSize);
+        TraceLog(LOG_INFO, "   Channels: %i (%s)", music.stream.channels, (music.stream.channels == 1)? "Mono" : (music.stream.channels == 2)? "Stereo" : "Multi");
+    }
+
     return music;
 }
 
@@ -1399,12 +1629,14 @@ void StopMusicStream(Music music)
 // Update (re-fill) music buffers if data already processed
 void UpdateMusicStream(Music music)
 {
+    TRACE_ZONE_BEGIN("UpdateMusicStream");
+
     bool streamEnding = false;
 
     unsigned int subBufferSizeInFrames = music.stream.buffer->bufferSizeInFrames/2;
 
     // NOTE: Using dynamic allocation because it could require more than 16KB
-    void *pcm = RL_CALLOC(subBufferSizeInFrames*music.stream.channels*music.stream.sampleSize/8, 1);
+    void *pcm = RL_FRAME_CALLOC(subBufferSizeInFrames*music.stream.channels*music.stream.sampleSize/8, 1);
 
     int samplesCount = 0;    // Total size of data streamed in L+R samples for xm floats, individual L or R for ogg shorts
 
@@ -1477,7 +1709,7 @@ void UpdateMusicStream(Music music)
     }
 
     // Free allocated pcm data
-    RL_FREE(pcm);
+    RL_FRAME_FREE(pcm);
 
     // Reset audio stream for looping
     if (streamEnding)
@@ -1498,6 +1730,8 @@ void UpdateMusicStream(Music music)
         // just make sure to play again on window restore
         if (IsMusicPlaying(music)) PlayMusicStream(music);
     }
+
+    TRACE_ZONE_END();
 }
 
 // Check if any music is playing
@@ -1700,6 +1934,34 @@ void SetAudioStreamPitch(AudioStream stream, float pitch)
 #if defined(SUPPORT_FILEFORMAT_WAV)
 // Load WAV file into Wave structure
 static Wave LoadWAV(const char *fileName)
+{
+    Wave wave = { 0 };
+    FILE *wavFile = fopen(fileName, "rb");
+
+    if (wavFile == NULL) TraceLog(LOG_WARNING, "[%s] WAV file could not be opened", fileName);
+    else
+    {
+        fseek(wavFile, 0, SEEK_END);
+        long size = ftell(wavFile);     // Get file size
+        fseek(wavFile, 0, SEEK_SET);    // Reset file pointer
+
+        unsigned char *fileData = (unsigned char *)RL_MALLOC(size);
+
+        if (fread(fileData, size, 1, wavFile) == 1) wave = LoadWAVFromMemory(fileData, (unsigned int)size);
+        else TraceLog(LOG_WARNING, "[%s] WAV file could not be read", fileName);
+
+        RL_FREE(fileData);
+        fclose(wavFile);
+
+        if (wave.data != NULL) TraceLog(LOG_INFO, "[%s] WAV file loaded successfully (%i Hz, %i bit, %s)", fileName, wave.sampleRate, wave.sampleSize, (wave.channels == 1)? "Mono" : "Stereo");
+    }
+
+    return wave;
+}
+
+// Load WAV data from memory buffer into Wave structure
+// NOTE: Headers are parsed in-place, only PCM samples data is copied into wave.data
+static Wave LoadWAVFromMemory(const unsigned char *fileData, unsigned int dataSize)
 {
     // Basic WAV headers structs
     typedef struct {
@@ -1729,89 +1991,86 @@ static Wave LoadWAV(const char *fileName)
     WAVData wavData;
 
     Wave wave = { 0 };
-    FILE *wavFile;
-
-    wavFile = fopen(fileName, "rb");
+    unsigned int offset = 0;
 
-    if (wavFile == NULL)
+    if (dataSize < (sizeof(WAVRiffHeader) + sizeof(WAVFormat) + sizeof(WAVData)))
     {
-        TraceLog(LOG_WARNING, "[%s] WAV file could not be opened", fileName);
-        wave.data = NULL;
+        TraceLog(LOG_WARNING, "WAV data size too small to contain valid headers");
+        return wave;
     }
-    else
-    {
-        // Read in the first chunk into the struct
-        fread(&wavRiffHeader, sizeof(WAVRiffHeader), 1, wavFile);
 
-        // Check for RIFF and WAVE tags
-        if (strncmp(wavRiffHeader.chunkID, "RIFF", 4) ||
-            strncmp(wavRiffHeader.format, "WAVE", 4))
-        {
-                TraceLog(LOG_WARNING, "[%s] Invalid RIFF or WAVE Header", fileName);
-        }
-        else
-        {
-            // Read in the 2nd chunk for the wave info
-            fread(&wavFormat, sizeof(WAVFormat), 1, wavFile);
+    // Read in the first chunk into the struct
+    memcpy(&wavRiffHeader, fileData + offset, sizeof(WAVRiffHeader));
+    offset += sizeof(WAVRiffHeader);
 
-            // Check for fmt tag
-            if ((wavFormat.subChunkID[0] != 'f') || (wavFormat.subChunkID[1] != 'm') ||
-                (wavFormat.subChunkID[2] != 't') || (wavFormat.subChunkID[3] != ' '))
-            {
-                TraceLog(LOG_WARNING, "[%s] Invalid Wave format", fileName);
-            }
-            else
-            {
-                // Check for extra parameters;
-                if (wavFormat.subChunkSize > 16) fseek(wavFile, sizeof(short), SEEK_CUR);
+    // Check for RIFF and WAVE tags
+    if (strncmp(wavRiffHeader.chunkID, "RIFF", 4) ||
+        strncmp(wavRiffHeader.format, "WAVE", 4))
+    {
+        TraceLog(LOG_WARNING, "Invalid RIFF or WAVE Header");
+        return wave;
+    }
 
-                // Read in the the last byte of data before the sound file
-                fread(&wavData, sizeof(WAVData), 1, wavFile);
+    // Read in the 2nd chunk for the wave info
+    memcpy(&wavFormat, fileData + offset, sizeof(WAVFormat));
+    offset += sizeof(WAVFormat);
 
-                // Check for data tag
-                if ((wavData.subChunkID[0] != 'd') || (wavData.subChunkID[1] != 'a') ||
-                    (wavData.subChunkID[2] != 't') || (wavData.subChunkID[3] != 'a'))
-                {
-                    TraceLog(LOG_WARNING, "[%s] Invalid data header", fileName);
-                }
-                else
-                {
-                    // Allocate memory for data
-                    wave.data = RL_MALLOC(wavData.subChunkSize);
+    // Check for fmt tag
+    if ((wavFormat.subChunkID[0] != 'f') || (wavFormat.subChunkID[1] != 'm') ||
+        (wavFormat.subChunkID[2] != 't') || (wavFormat.subChunkID[3] != ' '))
+    {
+        TraceLog(LOG_WARNING, "Invalid Wave format");
+        return wave;
+    }
 
-                    // Read in the sound data into the soundData variable
-                    fread(wave.data, wavData.subChunkSize, 1, wavFile);
+    // Check for extra parameters;
+    if (wavFormat.subChunkSize > 16) offset += sizeof(short);
 
-                    // Store wave parameters
-                    wave.sampleRate = wavFormat.sampleRate;
-                    wave.sampleSize = wavFormat.bitsPerSample;
-                    wave.channels = wavFormat.numChannels;
+    // Read in the the last byte of data before the sound file
+    if ((offset + sizeof(WAVData)) > dataSize)
+    {
+        TraceLog(LOG_WARNING, "Invalid data header");
+        return wave;
+    }
 
-                    // NOTE: Only support 8 bit, 16 bit and 32 bit sample sizes
-                    if ((wave.sampleSize != 8) && (wave.sampleSize != 16) && (wave.sampleSize != 32))
-                    {
-                        TraceLog(LOG_WARNING, "[%s] WAV sample size (%ibit) not supported, converted to 16bit", fileName, wave.sampleSize);
-                        WaveFormat(&wave, wave.sampleRate, 16, wave.channels);
-                    }
+    memcpy(&wavData, fileData + offset, sizeof(WAVData));
+    offset += sizeof(WAVData);
 
-                    // NOTE: Only support up to 2 channels (mono, stereo)
-                    if (wave.channels > 2)
-                    {
-                        WaveFormat(&wave, wave.sampleRate, wave.sampleSize, 2);
-                        TraceLog(LOG_WARNING, "[%s] WAV channels number (%i) not supported, converted to 2 channels", fileName, wave.channels);
-                    }
+    // Check for data tag
+    if ((wavData.subChunkID[0] != 'd') || (wavData.subChunkID[1] != 'a') ||
+        (wavData.subChunkID[2] != 't') || (wavData.subChunkID[3] != 'a') ||
+        (wavData.subChunkSize < 0) || ((offset + (unsigned int)wavData.subChunkSize) > dataSize))
+    {
+        TraceLog(LOG_WARNING, "Invalid data header");
+        return wave;
+    }
 
-                    // NOTE: subChunkSize comes in bytes, we need to translate it to number of samples
-                    wave.sampleCount = (wavData.subChunkSize/(wave.sampleSize/8))/wave.channels;
+    // Allocate memory for data and copy the sound data into it
+    wave.data = RL_MALLOC(wavData.subChunkSize);
+    memcpy(wave.data, fileData + offset, wavData.subChunkSize);
 
-                    TraceLog(LOG_INFO, "[%s] WAV file loaded successfully (%i Hz, %i bit, %s)", fileName, wave.sampleRate, wave.sampleSize, (wave.channels == 1)? "Mono" : "Stereo");
-                }
-            }
-        }
+    // Store wave parameters
+    wave.sampleRate = wavFormat.sampleRate;
+    wave.sampleSize = wavFormat.bitsPerSample;
+    wave.channels = wavFormat.numChannels;
 
-        fclose(wavFile);
+    // NOTE: Only support 8 bit, 16 bit and 32 bit sample sizes
+    if ((wave.sampleSize != 8) && (wave.sampleSize != 16) && (wave.sampleSize != 32))
+    {
+        TraceLog(LOG_WARNING, "WAV sample size (%ibit) not supported, converted to 16bit", wave.sampleSize);
+        WaveFormat(&wave, wave.sampleRate, 16, wave.channels);
     }
 
+    // NOTE: Only support up to 2 channels (mono, stereo)
+    if (wave.channels > 2)
+    {
+        WaveFormat(&wave, wave.sampleRate, wave.sampleSize, 2);
+        TraceLog(LOG_WARNING, "WAV channels number (%i) not supported, converted to 2 channels", wave.channels);
+    }
+
+    // NOTE: subChunkSize comes in bytes, we need to translate it to number of samples
+    wave.sampleCount = (wavData.subChunkSize/(wave.sampleSize/8))/wave.channels;
+
     return wave;
 }
 
@@ -1932,6 +2191,35 @@ static Wave LoadOGG(const char *fileName)
 
     return wave;
 }
+
+// Load OGG data from memory buffer into Wave structure
+// NOTE: Using stb_vorbis library, data is decoded directly from the provided buffer
+static Wave LoadOGGFromMemory(const unsigned char *fileData, unsigned int dataSize)
+{
+    Wave wave = { 0 };
+
+    stb_vorbis *oggData = stb_vorbis_open_memory(fileData, dataSize, NULL, NULL);
+
+    if (oggData == NULL) TraceLog(LOG_WARNING, "OGG data could not be opened from memory");
+    else
+    {
+        stb_vorbis_info info = stb_vorbis_get_info(oggData);
+
+        wave.sampleRate = info.sample_rate;
+        wave.sampleSize = 16;                   // 16 bit per sample (short)
+        wave.channels = info.channels;
+        wave.sampleCount = (unsigned int)stb_vorbis_stream_length_in_samples(oggData)*info.channels;  // Independent by channel
+
+        wave.data = (short *)RL_MALLOC(wave.sampleCount*wave.channels*sizeof(short));
+
+        // NOTE: Returns the number of samples to process (be careful! we ask for number of shorts!)
+        stb_vorbis_get_samples_short_interleaved(oggData, info.channels, (short *)wave.data, wave.sampleCount*wave.channels);
+
+        stb_vorbis_close(oggData);
+    }
+
+    return wave;
+}
 #endif
 
 #if defined(SUPPORT_FILEFORMAT_FLAC)
@@ -1956,6 +2244,27 @@ static Wave LoadFLAC(const char *fileName)
 
     return wave;
 }
+
+// Load FLAC data from memory buffer into Wave structure
+// NOTE: Using dr_flac library, data is decoded directly from the provided buffer
+static Wave LoadFLACFromMemory(const unsigned char *fileData, unsigned int dataSize)
+{
+    Wave wave = { 0 };
+
+    // Decode an entire FLAC stream in one go
+    uint64_t totalSampleCount = 0;
+    wave.data = drflac_open_memory_and_read_pcm_frames_s16(fileData, dataSize, &wave.channels, &wave.sampleRate, &totalSampleCount);
+
+    wave.sampleCount = (unsigned int)totalSampleCount;
+    wave.sampleSize = 16;
+
+    // NOTE: Only support up to 2 channels (mono, stereo)
+    if (wave.channels > 2) TraceLog(LOG_WARNING, "FLAC channels number (%i) not supported", wave.channels);
+
+    if (wave.data == NULL) TraceLog(LOG_WARNING, "FLAC data could not be loaded from memory");
+
+    return wave;
+}
 #endif
 
 #if defined(SUPPORT_FILEFORMAT_MP3)
@@ -1983,8 +2292,48 @@ static Wave LoadMP3(const char *fileName)
 
     return wave;
 }
+
+// Load MP3 data from memory buffer into Wave structure
+// NOTE: Using dr_mp3 library, data is decoded directly from the provided buffer
+static Wave LoadMP3FromMemory(const unsigned char *fileData, unsigned int dataSize)
+{
+    Wave wave = { 0 };
+
+    // Decode an entire MP3 stream in one go
+    uint64_t totalFrameCount = 0;
+    drmp3_config config = { 0 };
+    wave.data = drmp3_open_memory_and_read_f32(fileData, dataSize, &config, &totalFrameCount);
+
+    wave.channels = config.outputChannels;
+    wave.sampleRate = config.outputSampleRate;
+    wave.sampleCount = (int)totalFrameCount*wave.channels;
+    wave.sampleSize = 32;
+
+    // NOTE: Only support up to 2 channels (mono, stereo)
+    if (wave.channels > 2) TraceLog(LOG_WARNING, "MP3 channels number (%i) not supported", wave.channels);
+
+    if (wave.data == NULL) TraceLog(LOG_WARNING, "MP3 data could not be loaded from memory");
+
+    return wave;
+}
 #endif
 
+// Check memory buffer file type, i.e. ".ogg"
+// NOTE: fileType is a bare extension (not a file name), leading dot is skipped and case is ignored
+static bool IsFileType(const char *fileType, const char *ext)
+{
+    if (fileType[0] == '.') fileType++;
+    if (ext[0] == '.') ext++;
+
+    while ((*fileType != '\0') && (tolower((unsigned char)*fileType) == tolower((unsigned char)*ext)))
+    {
+        fileType++;
+        ext++;
+    }
+
+    return ((*fileType == '\0') && (*ext == '\0'));
+}
+
 // Some required functions for audio standalone module version
 #if defined(RAUDIO_STANDALONE)
 // Check file extension
@@ -75,6 +75,7 @@
 #define RAYLIB_H
 
 #include <stdarg.h>     // Required for: va_list - Only used by TraceLogCallback
+#include <stddef.h>     // Required for: size_t - Only used by memory allocator functions
 
 #define RLAPI           // We are building or using raylib as a static library (or Linux shared library)
 
@@ -98,19 +99,21 @@
 #define RAD2DEG (180.0f/PI)
 
 #define MAX_TOUCH_POINTS        10      // Maximum number of touch points supported
+#define MAX_MEMORY_MODULES       7      // Number of memory allocations modules (MemoryModule)
 
 // Allow custom memory allocators
+// NOTE: By default raylib allocations go through the runtime allocator (SetMemAllocator())
 #ifndef RL_MALLOC
-    #define RL_MALLOC(sz)       malloc(sz)
+    #define RL_MALLOC(sz)       MemAlloc(sz)
 #endif
 #ifndef RL_CALLOC
-    #define RL_CALLOC(n,sz)     calloc(n,sz)
+    #define RL_CALLOC(n,sz)     MemCalloc(n,sz)
 #endif
 #ifndef RL_REALLOC
-    #define RL_REALLOC(n,sz)    realloc(n,sz)
+    #define RL_REALLOC(n,sz)    MemRealloc(n,sz)
 #endif
 #ifndef RL_FREE
-    #define RL_FREE(p)          free(p)
+    #define RL_FREE(p)          MemFree(p)
 #endif
 
 // NOTE: MSC C++ compiler does not support compound literals (C99 feature)
@@ -271,6 +274,9 @@ typedef struct CharInfo {
     Image image;            // Character image data
 } CharInfo;
 
+// Glyph lookup table, opaque struct (codepoint to glyph index)
+typedef struct GlyphLookup GlyphLookup;
+
 // Font type, includes texture and charSet array data
 typedef struct Font {
     int baseSize;           // Base size (default chars height)
@@ -278,6 +284,7 @@ typedef struct Font {
     Texture2D texture;      // Characters texture atlas
     Rectangle *recs;        // Characters rectangles in texture
     CharInfo *chars;        // Characters info data
+    GlyphLookup *glyphLookup; // Glyph lookup table, built on font loading (NULL uses linear search)
 } Font;
 
 #define SpriteFont Font     // SpriteFont type fallback, defaults to Font
@@ -459,6 +466,49 @@ typedef struct VrDeviceInfo {
     float chromaAbCorrection[4];    // HMD chromatic aberration correction parameters
 } VrDeviceInfo;
 
+// Video recording statistics
+typedef struct VideoRecordingStats {
+    int framesCaptured;             // Frames queued for recording (one by frame drawn)
+    int framesWritten;              // Frames converted and written to output
+    int queueLength;                // Frames waiting to be written (pending screen reads and encoding queue)
+    int maxQueueLength;             // Maximum frames waiting to be written
+    int stallCount;                 // Frames the game loop blocked because recording queues were full (backpressure)
+    double stallTime;               // Total time blocked on full recording queues (in seconds)
+} VideoRecordingStats;
+
+// Frame time breakdown (in seconds)
+typedef struct FrameTiming {
+    float update;                   // Game update time (EndDrawing() to BeginDrawing())
+    float draw;                     // Draw time (BeginDrawing() to buffers swap, includes batch flush)
+    float swap;                     // Buffers swap time (includes driver vsync wait)
+    float poll;                     // Input events polling time
+    float wait;                     // Wait time to reach target FPS
+    float total;                    // Total frame time
+} FrameTiming;
+
+// Frame time statistics over a rolling window of frames
+typedef struct FrameStats {
+    FrameTiming last;               // Last frame timing
+    FrameTiming min;                // Minimum times in window
+    FrameTiming avg;                // Average times in window
+    FrameTiming p99;                // 99th percentile times in window
+    int frameCount;                 // Number of frames in window
+} FrameStats;
+
+// Memory allocations statistics (SUPPORT_MEMORY_TRACKING)
+// NOTE: Frame values refer to last completed frame (EndDrawing() to EndDrawing())
+typedef struct MemoryStats {
+    int frameAllocs;                // Allocations in frame (malloc, calloc and realloc)
+    int frameFrees;                 // Frees in frame
+    long long frameBytes;           // Bytes allocated in frame
+    int liveAllocs;                 // Number of live allocations
+    long long liveBytes;            // Live allocated bytes
+    long long peakBytes;            // Peak of live allocated bytes
+    long long totalAllocs;          // Allocations since program start
+    int moduleFrameAllocs[MAX_MEMORY_MODULES];  // Allocations in frame by module (MemoryModule)
+    long long moduleLiveBytes[MAX_MEMORY_MODULES]; // Live allocated bytes by module (MemoryModule)
+} MemoryStats;
+
 //----------------------------------------------------------------------------------
 // Enumerators Definition
 //----------------------------------------------------------------------------------
@@ -488,6 +538,17 @@ typedef enum {
     LOG_NONE            // Disable logging
 } TraceLogType;
 
+// Memory allocations module (call site source file)
+typedef enum {
+    MEMORY_CORE = 0,    // core, utils and trace zones
+    MEMORY_RLGL,
+    MEMORY_TEXT,        // text and font libraries (stb_truetype, stb_rect_pack)
+    MEMORY_TEXTURES,    // textures and image libraries (stb_image, stb_image_resize, stb_image_write)
+    MEMORY_RAUDIO,      // raudio and audio libraries (miniaudio, stb_vorbis, dr_flac, dr_mp3, jar_xm, jar_mod)
+    MEMORY_MODELS,      // models and mesh libraries (cgltf, tinyobj_loader, par_shapes)
+    MEMORY_OTHER
+} MemoryModule;
+
 // Keyboard keys
 typedef enum {
     // Alphanumeric keys
@@ -849,9 +910,29 @@ typedef enum {
     NPT_3PATCH_HORIZONTAL   // Npatch defined by 3x1 tiles
 } NPatchType;
 
+// Video recording output formats
+typedef enum {
+    VIDEO_FORMAT_RGBA = 0,  // Raw RGBA frames, no header (8 bit per channel)
+    VIDEO_FORMAT_Y4M        // YUV4MPEG2 stream, YUV420 full range (C420jpeg)
+} VideoFormat;
+
 // Callbacks to be implemented by users
 typedef void (*TraceLogCallback)(int logType, const char *text, va_list args);
 
+// Memory allocator callbacks, context is the allocator user context
+// NOTE: alignment is a power of two, 0 means default malloc() alignment (same value on alloc, realloc and free)
+typedef void *(*MemAllocCallback)(void *context, size_t size, size_t alignment);
+typedef void *(*MemReallocCallback)(void *context, void *ptr, size_t size, size_t alignment);
+typedef void (*MemFreeCallback)(void *context, void *ptr, size_t alignment);
+
+// Memory allocator, used by raylib and external libraries (stb_image, miniaudio, dr_mp3, cgltf...)
+typedef struct MemAllocator {
+    MemAllocCallback onAlloc;       // Allocate memory (uninitialized)
+    MemReallocCallback onRealloc;   // Reallocate memory, ptr can be NULL
+    MemFreeCallback onFree;         // Free memory, ptr can be NULL
+    void *context;                  // User context passed to callbacks
+} MemAllocator;
+
 #if defined(__cplusplus)
 extern "C" {            // Prevents name mangling of functions
 #endif
@@ -928,6 +1009,8 @@ RLAPI void SetTargetFPS(int fps);                                 // Set target
 RLAPI int GetFPS(void);                                           // Returns current FPS
 RLAPI float GetFrameTime(void);                                   // Returns time in seconds for last frame drawn
 RLAPI double GetTime(void);                                       // Returns elapsed time in seconds since InitWindow()
+RLAPI FrameStats GetFrameStats(void);                             // Returns frame time breakdown statistics (rolling window)
+RLAPI void ToggleFrameStatsOverlay(void);                         // Toggle frame time graph overlay (drawn on EndDrawing())
 
 // Color-related functions
 RLAPI int ColorToInt(Color color);                                // Returns hexadecimal value for a Color
@@ -945,6 +1028,21 @@ RLAPI void SetTraceLogExit(int logType);                          // Set the exi
 RLAPI void SetTraceLogCallback(TraceLogCallback callback);        // Set a trace log callback to enable custom logging
 RLAPI void TraceLog(int logType, const char *text, ...);          // Show trace log messages (LOG_DEBUG, LOG_INFO, LOG_WARNING, LOG_ERROR)
 RLAPI void TakeScreenshot(const char *fileName);                  // Takes a screenshot of current screen (saved a .png)
+RLAPI bool BeginVideoRecording(const char *fileName, int format, int fps); // Begin recording every frame drawn as raw video (file or "|command" pipe)
+RLAPI void EndVideoRecording(void);                               // End video recording (pending frames are written)
+RLAPI bool IsVideoRecording(void);                                // Check if video is being recorded
+RLAPI VideoRecordingStats GetVideoRecordingStats(void);           // Get video recording statistics (last recording)
+RLAPI MemoryStats GetMemoryStats(void);                           // Get memory allocations statistics (requires SUPPORT_MEMORY_TRACKING)
+RLAPI void SetMemoryFrameGuard(bool enabled);                     // Set allocations guard, any allocation in a frame is reported with its call site
+RLAPI void TraceMemoryStats(void);                                // Show memory statistics by module and top allocation call sites (LOG_INFO)
+RLAPI void SetMemAllocator(MemAllocator allocator);               // Set memory allocator (call before any raylib allocation, NULL callbacks reset default)
+RLAPI MemAllocator GetMemAllocator(void);                         // Get current memory allocator
+RLAPI void *MemAlloc(size_t size);                                // Allocate memory with current allocator
+RLAPI void *MemAllocAligned(size_t size, size_t alignment);       // Allocate aligned memory with current allocator (alignment power of two)
+RLAPI void *MemCalloc(size_t count, size_t size);                 // Allocate zeroed memory with current allocator
+RLAPI void *MemRealloc(void *ptr, size_t size);                   // Reallocate memory with current allocator
+RLAPI void MemFree(void *ptr);                                    // Free memory allocated by raylib (or MemAlloc(), MemCalloc(), MemRealloc())
+RLAPI void MemFreeAligned(void *ptr, size_t alignment);           // Free memory allocated with MemAllocAligned()
 RLAPI int GetRandomValue(int min, int max);                       // Returns a random value between min and max (both included)
 
 // Files management functions
@@ -1098,6 +1196,7 @@ RLAPI Image LoadImage(const char *fileName);
 RLAPI Image LoadImageEx(Color *pixels, int width, int height);                                           // Load image from Color array data (RGBA - 32bit)
 RLAPI Image LoadImagePro(void *data, int width, int height, int format);                                 // Load image from raw data with parameters
 RLAPI Image LoadImageRaw(const char *fileName, int width, int height, int format, int headerSize);       // Load image from RAW file data
+RLAPI Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize);      // Load image from memory buffer, fileType refers to extension: i.e. ".png"
 RLAPI void ExportImage(Image image, const char *fileName);                                               // Export image data to file
 RLAPI void ExportImageAsCode(Image image, const char *fileName);                                         // Export image as code file defining an array of bytes
 RLAPI Texture2D LoadTexture(const char *fileName);                                                       // Load texture from file into GPU memory (VRAM)
@@ -1114,6 +1213,7 @@ RLAPI int GetPixelDataSize(int width, int height, int format);
 RLAPI Image GetTextureData(Texture2D texture);                                                           // Get pixel data from GPU texture and return an Image
 RLAPI Image GetScreenData(void);                                                                         // Get pixel data from screen buffer and return an Image (screenshot)
 RLAPI void UpdateTexture(Texture2D texture, const void *pixels);                                         // Update GPU texture with new data
+RLAPI void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels);                       // Update GPU texture rectangle with new data
 
 // Image manipulation functions
 RLAPI Image ImageCopy(Image image);                                                                      // Create an image duplicate (useful for transformations)
@@ -1182,6 +1282,9 @@ RLAPI Font GetFontDefault(void);
 RLAPI Font LoadFont(const char *fileName);                                                  // Load font from file into GPU memory (VRAM)
 RLAPI Font LoadFontEx(const char *fileName, int fontSize, int *fontChars, int charsCount);  // Load font from file with extended parameters
 RLAPI Font LoadFontFromImage(Image image, Color key, int firstChar);                        // Load font from Image (XNA style)
+RLAPI Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int charsCount); // Load font from memory buffer, fileType refers to extension: i.e. ".ttf"
+RLAPI Font LoadFontDynamic(const char *fileName, int fontSize, int maxGlyphs);              // Load font from TTF/OTF file, glyphs are rasterized on first use (growable atlas)
+RLAPI Font LoadFontDynamicFromMemory(const unsigned char *fileData, int dataSize, int fontSize, int maxGlyphs); // Load dynamic font from TTF/OTF memory buffer
 RLAPI CharInfo *LoadFontData(const char *fileName, int fontSize, int *fontChars, int charsCount, int type); // Load font data for further use
 RLAPI Image GenImageFontAtlas(const CharInfo *chars, Rectangle **recs, int charsCount, int fontSize, int padding, int packMethod);  // Generate image font atlas using chars info
 RLAPI void UnloadFont(Font font);                                                           // Unload Font from GPU memory (VRAM)
@@ -1199,12 +1302,16 @@ RLAPI void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float s
 RLAPI int MeasureText(const char *text, int fontSize);                                      // Measure string width for default font
 RLAPI Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing);    // Measure string size for Font
 RLAPI int GetGlyphIndex(Font font, int codepoint);                                          // Get index position for a unicode character on font
+RLAPI int LoadFontGlyphs(Font *font, const char *text);                                     // Load dynamic font glyphs used in text, font is updated with current atlas
+RLAPI void SetTextLayoutCacheBudget(int bytes);                                             // Set text layout cache memory budget in bytes, 0 disables the cache
 
 // Text strings management functions (no utf8 strings, only byte chars)
 // NOTE: Some strings allocate memory internally for returned strings, just be careful!
 RLAPI bool TextIsEqual(const char *text1, const char *text2);                               // Check if two text string are equal
 RLAPI unsigned int TextLength(const char *text);                                            // Get text length, checks for '\0' ending
 RLAPI const char *TextFormat(const char *text, ...);                                        // Text formatting with variables (sprintf style)
+RLAPI int TextFormatBuffer(char *buffer, int bufferSize, const char *text, ...);          // Text formatting with variables into provided buffer, returns length (thread-safe)
+RLAPI const char *TextFormatFrame(const char *text, ...);                                   // Text formatting with variables into frame memory (valid until EndDrawing())
 RLAPI const char *TextSubtext(const char *text, int position, int length);                  // Get a piece of a text string
 RLAPI char *TextReplace(char *text, const char *replace, const char *by);                   // Replace text string (memory must be freed!)
 RLAPI char *TextInsert(const char *text, const char *insert, int position);                 // Insert text in a position (memory must be freed!)
@@ -1371,6 +1478,7 @@ RLAPI void SetMasterVolume(float volume);                             // Set mas
 
 // Wave/Sound loading/unloading functions
 RLAPI Wave LoadWave(const char *fileName);                            // Load wave data from file
+RLAPI Wave LoadWaveFromMemory(const char *fileType, const unsigned char *fileData, int dataSize); // Load wave from memory buffer, fileType refers to extension: i.e. ".wav"
 RLAPI Sound LoadSound(const char *fileName);                          // Load sound from file
 RLAPI Sound LoadSoundFromWave(Wave wave);                             // Load sound from wave data
 RLAPI void UpdateSound(Sound sound, const void *data, int samplesCount);// Update sound buffer with new data
@@ -1397,6 +1505,7 @@ RLAPI float *GetWaveData(Wave wave);                                  // Get sam
 
 // Music management functions
 RLAPI Music LoadMusicStream(const char *fileName);                    // Load music stream from file
+RLAPI Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data, int dataSize); // Load music stream from memory buffer (must be kept alive while streaming)
 RLAPI void UnloadMusicStream(Music music);                            // Unload music stream
 RLAPI void PlayMusicStream(Music music);                              // Start music playing
 RLAPI void UpdateMusicStream(Music music);                            // Updates buffers for music streaming
@@ -33,7 +33,7 @@
     #define _GLFW_WIN32
 #endif
 #if defined(__linux__)
-    #if !defined(_GLFW_WAYLAND)     // Required for Wayland windowing
+    #if !defined(_GLFW_WAYLAND) && !defined(_GLFW_OSMESA)   // Required for Wayland windowing or headless (OSMesa)
         #define _GLFW_X11
     #endif
 #endif
@@ -70,7 +70,16 @@
     #include "external/glfw/src/osmesa_context.c"
 #endif
 
-#if defined(__linux__)
+#if defined(__linux__) && defined(_GLFW_OSMESA)
+    // NOTE: Headless mode, no display required, OSMesa offscreen context (libOSMesa loaded at runtime)
+    #include "external/glfw/src/null_init.c"
+    #include "external/glfw/src/null_monitor.c"
+    #include "external/glfw/src/null_window.c"
+    #include "external/glfw/src/null_joystick.c"
+    #include "external/glfw/src/posix_thread.c"
+    #include "external/glfw/src/posix_time.c"
+    #include "external/glfw/src/osmesa_context.c"
+#elif defined(__linux__)
     #if defined(_GLFW_WAYLAND)
         #include "external/glfw/src/wl_init.c"
         #include "external/glfw/src/wl_monitor.c"
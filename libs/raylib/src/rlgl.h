@@ -132,7 +132,25 @@
     #define MAX_BATCH_ELEMENTS            2048
 #endif
 
-#define MAX_BATCH_BUFFERING                  1      // Max number of buffers for batching (multi-buffering)
+#if !defined(MAX_BATCH_BUFFERING)
+    // Number of batch buffers used in round-robin, so CPU can fill one while GPU reads the others
+    // NOTE: Every buffer requires its own CPU and GPU memory (MAX_BATCH_ELEMENTS quads)
+    #if defined(GRAPHICS_API_OPENGL_ES2)
+        #define MAX_BATCH_BUFFERING          1      // Max number of buffers for batching (multi-buffering)
+    #else
+        #define MAX_BATCH_BUFFERING          3      // Max number of buffers for batching (multi-buffering)
+    #endif
+#endif
+#if !defined(MAX_SCREEN_READBACKS)
+    // Number of asynchronous screen readbacks in flight (pixel buffer objects ring)
+    #define MAX_SCREEN_READBACKS             3      // Max number of queued screen pixels reads
+#endif
+#if !defined(MAX_GPU_TIMER_FRAMES)
+    // Number of frames of GPU timer queries in flight, results are read back MAX_GPU_TIMER_FRAMES - 1 frames later
+    #define MAX_GPU_TIMER_FRAMES             4      // Max number of frames timed by GPU at the same time
+#endif
+#define MAX_GPU_TIMER_QUERIES              256      // Max timestamp queries by frame (2 by pass run)
+#define MAX_GPU_PASSES                      16      // Max different passes reported by frame
 #define MAX_MATRIX_STACK_SIZE               32      // Max size of Matrix stack
 #define MAX_DRAWCALL_REGISTERED            256      // Max draws by state changes (mode, texture)
 
@@ -416,6 +434,59 @@ typedef unsigned char byte;
     #define MAP_SPECULAR     MAP_METALNESS
 #endif
 
+// Internal batch buffering statistics
+// NOTE: Times are measured in seconds (only available if not RLGL_STANDALONE)
+typedef struct BatchStats {
+    int buffersCount;           // Number of batch buffers used in round-robin (MAX_BATCH_BUFFERING)
+    bool persistentMapping;     // Batch buffers are persistently mapped (GL_ARB_buffer_storage)
+    int flushCount;             // Number of batch flushes (buffers update + draw)
+    int stallCount;             // Number of flushes where the buffer to fill was still in use by GPU
+    double stallTime;           // Time waiting for the GPU to release a buffer (fences wait)
+    double uploadTime;          // Time uploading vertex data to GPU (includes driver-side sync)
+    int drawCallsCount;         // Number of draw calls issued for the batch (after sorting, if enabled)
+} BatchStats;
+
+// Batch flush reasons (rlglDrawEx())
+typedef enum {
+    RL_FLUSH_STATE = 0,         // Explicit flush or render state change (shader, blend mode, render target...)
+    RL_FLUSH_BUFFER_FULL,       // Vertex buffer limit reached
+    RL_FLUSH_DRAWCALLS_FULL,    // MAX_DRAWCALL_REGISTERED reached
+    RL_FLUSH_MATRIX,            // Matrix stack/mode change (BeginMode2D(), BeginMode3D()...)
+    RL_FLUSH_END_FRAME          // End of frame
+} FlushReason;
+
+#define RL_FLUSH_REASONS    5   // Number of flush reasons (FlushReason)
+
+// GPU time of a pass, all runs on frame added
+typedef struct GpuPassTime {
+    const char *name;           // Pass name
+    int count;                  // Number of pass runs on frame
+    float time;                 // GPU time in milliseconds
+} GpuPassTime;
+
+// Per-frame render statistics
+// NOTE: Counters include default batch draws and rlDrawMesh() draws
+typedef struct RenderStats {
+    int drawCalls;              // Number of draw calls issued
+    int vertexCount;            // Number of vertices submitted
+    int indexCount;             // Number of indices submitted (indexed draws)
+    int flushCount;             // Number of batch flushes
+    int flushReasons[RL_FLUSH_REASONS]; // Number of batch flushes by reason (FlushReason)
+    int textureBinds;           // Number of texture binds
+    int shaderSwitches;         // Number of shader program changes between draws
+    long long uploadedBytes;    // Bytes uploaded to GPU (batch vertex data, buffer and texture updates)
+} RenderStats;
+
+// Per-frame GPU times (timer queries)
+// NOTE: Nested passes time is also included in parent pass time (i.e. "batch" flushes inside "mode3d")
+typedef struct GpuTimes {
+    bool ready;                 // GPU times available (timer queries supported and first results read back)
+    int frameDelay;             // Number of frames between timed frame and last completed frame
+    float frameTime;            // GPU time from frame start to frame end in milliseconds
+    int passCount;              // Number of different passes timed
+    GpuPassTime passes[MAX_GPU_PASSES]; // Passes GPU time, in order of first run
+} GpuTimes;
+
 #if defined(__cplusplus)
 extern "C" {            // Prevents name mangling of functions
 #endif
@@ -448,6 +519,7 @@ RLAPI void rlNormal3f(float x, float y, float z);     // Define one vertex (norm
 RLAPI void rlColor4ub(byte r, byte g, byte b, byte a);    // Define one vertex (color) - 4 byte
 RLAPI void rlColor3f(float x, float y, float z);          // Define one vertex (color) - 3 float
 RLAPI void rlColor4f(float x, float y, float z, float w); // Define one vertex (color) - 4 float
+RLAPI void rlVertexArray2f(int mode, const float *vertices, const float *texcoords, const unsigned char *colors, int vertexCount); // Define a block of vertex (QUADS or TRIANGLES)
 
 //------------------------------------------------------------------------------------
 // Functions Declaration - OpenGL equivalent functions (common to 1.1, 3.3+, ES2)
@@ -483,9 +555,20 @@ RLAPI unsigned int rlLoadAttribBuffer(unsigned int vaoId, int shaderLoc, void *b
 RLAPI void rlglInit(int width, int height);           // Initialize rlgl (buffers, shaders, textures, states)
 RLAPI void rlglClose(void);                           // De-inititialize rlgl (buffers, shaders, textures)
 RLAPI void rlglDraw(void);                            // Update and draw default internal buffers
+RLAPI void rlglDrawEx(int reason);                    // Update and draw default internal buffers, flush reason recorded (FlushReason)
 
 RLAPI int rlGetVersion(void);                         // Returns current OpenGL version
 RLAPI bool rlCheckBufferLimit(int vCount);            // Check internal buffer overflow for a given number of vertex
+RLAPI BatchStats rlGetBatchStats(void);               // Get internal batch buffering statistics (stalls, upload time)
+RLAPI void rlResetBatchStats(void);                   // Reset internal batch buffering statistics
+RLAPI RenderStats rlGetRenderStats(void);             // Get render statistics of last completed frame
+RLAPI void rlUpdateRenderStats(void);                 // Close current frame render statistics (called by EndDrawing())
+RLAPI void rlBeginGpuPass(const char *name);          // Begin GPU timed pass (name must be a static string)
+RLAPI void rlEndGpuPass(void);                        // End GPU timed pass
+RLAPI void rlUpdateGpuTimes(void);                    // Close current frame GPU timing and read back completed frames (called by EndDrawing())
+RLAPI GpuTimes rlGetGpuTimes(void);                   // Get GPU times of last frame read back (delayed frames)
+RLAPI void rlEnableDrawSorting(void);                 // Enable batch draw calls sorting by texture and mode (2D, keeps overlapping order)
+RLAPI void rlDisableDrawSorting(void);                // Disable batch draw calls sorting (submission order)
 RLAPI void rlSetDebugMarker(const char *text);        // Set debug marker for analysis
 RLAPI void rlLoadExtensions(void *loader);            // Load OpenGL extensions
 RLAPI Vector3 rlUnproject(Vector3 source, Matrix proj, Matrix view);  // Get world coordinates from screen coordinates
@@ -495,12 +578,15 @@ RLAPI unsigned int rlLoadTexture(void *data, int width, int height, int format,
 RLAPI unsigned int rlLoadTextureDepth(int width, int height, int bits, bool useRenderBuffer);     // Load depth texture/renderbuffer (to be attached to fbo)
 RLAPI unsigned int rlLoadTextureCubemap(void *data, int size, int format);                        // Load texture cubemap
 RLAPI void rlUpdateTexture(unsigned int id, int width, int height, int format, const void *data); // Update GPU texture with new data
+RLAPI void rlUpdateTextureRec(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data); // Update GPU texture rectangle with new data
 RLAPI void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType);  // Get OpenGL internal formats
 RLAPI void rlUnloadTexture(unsigned int id);                              // Unload texture from GPU memory
 
 RLAPI void rlGenerateMipmaps(Texture2D *texture);                         // Generate mipmap data for selected texture
 RLAPI void *rlReadTexturePixels(Texture2D texture);                       // Read texture pixel data
 RLAPI unsigned char *rlReadScreenPixels(int width, int height);           // Read screen pixel data (color buffer)
+RLAPI bool rlReadScreenPixelsAsync(int width, int height);                // Queue screen pixel data read (color buffer), no CPU stall
+RLAPI unsigned char *rlGetScreenPixelsAsync(bool wait, int *width, int *height); // Get oldest queued screen pixel data if ready (NULL otherwise)
 
 // Render texture management (fbo)
 RLAPI RenderTexture2D rlLoadRenderTexture(int width, int height, int format, int depthBits, bool useDepthTexture);    // Load a render texture (with color and depth attachments)
@@ -592,6 +678,15 @@ RLAPI int GetPixelDataSize(int width, int height, int format);// Get pixel data
 #include <stdlib.h>                 // Required for: malloc(), free(), rand()
 #include <string.h>                 // Required for: strcmp(), strlen(), strtok() [Used only in extensions loading]
 #include <math.h>                   // Required for: atan2()
+#include <stddef.h>                 // Required for: offsetof() [Used only on interleaved 2D vertex data]
+
+#include "rtrace.h"                 // Required for: TRACE_ZONE_BEGIN(), TRACE_ZONE_END() [Only if SUPPORT_TRACING]
+
+// SSE is available on all x86-64 targets, used for vertex blocks transformation
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+    #define RLGL_SIMD_SSE
+    #include <xmmintrin.h>          // Required for: SSE intrinsics [Used only on rlVertexArray2f()]
+#endif
 
 #if !defined(RLGL_STANDALONE)
     #include "raymath.h"            // Required for: Vector3 and Matrix functions
@@ -650,6 +745,21 @@ RLAPI int GetPixelDataSize(int width, int height, int format);// Get pixel data
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
+// Time measurement for internal statistics, only available with raylib core module
+#if defined(RLGL_STANDALONE)
+    #define RLGL_GET_TIME()     0.0
+#else
+    #define RLGL_GET_TIME()     GetTime()
+#endif
+
+// Transient allocations, freed before the end of the frame (defined by utils.h, frame arena)
+#ifndef RL_FRAME_ALLOC
+    #define RL_FRAME_ALLOC(sz)      RL_MALLOC(sz)
+#endif
+#ifndef RL_FRAME_FREE
+    #define RL_FRAME_FREE(p)        RL_FREE(p)
+#endif
+
 #ifndef GL_SHADING_LANGUAGE_VERSION
     #define GL_SHADING_LANGUAGE_VERSION         0x8B8C
 #endif
@@ -725,14 +835,28 @@ RLAPI int GetPixelDataSize(int width, int height, int format);// Get pixel data
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
 
+#if defined(SUPPORT_BATCH_INTERLEAVED_2D)
+// Interleaved compact 2D vertex (16 bytes, instead of 24 bytes of separate arrays)
+// NOTE: Z is not stored (shader receives 0.0f) and texcoords are normalized to [0..1] range
+typedef struct Vertex2D {
+    float x, y;                 // vertex position (XY) (shader-location = 0)
+    unsigned short u, v;        // vertex texture coordinates (UV, normalized) (shader-location = 1)
+    unsigned char r, g, b, a;   // vertex color (RGBA) (shader-location = 3)
+} Vertex2D;
+#endif
+
 // Dynamic vertex buffers (position + texcoords + colors + indices arrays)
 typedef struct DynamicBuffer {
     int vCounter;               // vertex position counter to process (and draw) from full buffer
     int tcCounter;              // vertex texcoord counter to process (and draw) from full buffer
     int cCounter;               // vertex color counter to process (and draw) from full buffer
+#if defined(SUPPORT_BATCH_INTERLEAVED_2D)
+    Vertex2D *vertices;         // vertex interleaved data (position, texcoords, colors) (single VBO: vboId[0])
+#else
     float *vertices;            // vertex position (XYZ - 3 components per vertex) (shader-location = 0)
     float *texcoords;           // vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
     unsigned char *colors;      // vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
+#endif
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
     unsigned int *indices;      // vertex indices (in case vertex data comes indexed) (6 indices per quad)
 #elif defined(GRAPHICS_API_OPENGL_ES2)
@@ -741,6 +865,10 @@ typedef struct DynamicBuffer {
 #endif
     unsigned int vaoId;         // OpenGL Vertex Array Object id
     unsigned int vboId[4];      // OpenGL Vertex Buffer Objects id (4 types of vertex data)
+#if defined(GRAPHICS_API_OPENGL_33)
+    void *mapped[3];            // Persistently mapped GPU memory for vboId[0..2] (if supported)
+    GLsync fence;               // Fence signaled once GPU has consumed the buffer vertex data
+#endif
 } DynamicBuffer;
 
 // Draw call type
@@ -768,6 +896,34 @@ typedef struct VrStereoConfig {
 } VrStereoConfig;
 #endif
 
+#if defined(GRAPHICS_API_OPENGL_33)
+// Screen pixels asynchronous read, pixel buffer object filled by GPU
+typedef struct ScreenReadback {
+    unsigned int pboId;         // OpenGL pixel pack buffer id
+    int size;                   // Pixel buffer size in bytes
+    int width;                  // Read area width
+    int height;                 // Read area height
+    GLsync fence;               // Fence signaled once GPU has written the pixels
+} ScreenReadback;
+
+// GPU timed pass run, begin and end timestamp queries
+typedef struct GpuTimerPass {
+    const char *name;           // Pass name
+    int begin;                  // Begin timestamp query index
+    int end;                    // End timestamp query index (-1 if not ended)
+} GpuTimerPass;
+
+// GPU timer queries of one frame
+// NOTE: Pass 0 is the whole frame
+typedef struct GpuTimerFrame {
+    unsigned int queries[MAX_GPU_TIMER_QUERIES];    // OpenGL timestamp query objects ids
+    int queriesCounter;                             // Number of queries issued
+    GpuTimerPass passes[MAX_GPU_TIMER_QUERIES/2];   // Pass runs
+    int passesCounter;                              // Number of pass runs
+    bool pending;                                   // Queries issued, results not read yet
+} GpuTimerFrame;
+#endif
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -790,6 +946,22 @@ static bool useTransformMatrix = false;     // Use transform matrix against vert
 
 static DrawCall *draws = NULL;              // Draw calls array
 static int drawsCounter = 0;                // Draw calls counter
+static bool drawSorting = false;            // Sort draw calls by state before drawing (grouping by texture and mode)
+static DynamicBuffer sortData = { 0 };      // Scratch vertex arrays used to reorder batch data on draw calls sorting
+
+#if defined(GRAPHICS_API_OPENGL_33)
+static ScreenReadback readbacks[MAX_SCREEN_READBACKS] = { 0 }; // Screen readbacks ring (pixel buffer objects)
+static int readbacksFirst = 0;              // Oldest queued screen readback
+static int readbacksCounter = 0;            // Number of queued screen readbacks
+
+static GpuTimerFrame gpuTimers[MAX_GPU_TIMER_FRAMES] = { 0 }; // GPU timer queries ring (one slot by frame)
+static int gpuTimersCurrent = 0;            // Frame slot being recorded
+static int gpuPassStack[MAX_GPU_PASSES] = { 0 };    // Open pass runs (indexes on current frame slot)
+static int gpuPassDepth = 0;                // Number of open pass runs
+static int gpuPassOverflow = 0;             // Number of open pass runs over MAX_GPU_PASSES nesting (not timed)
+static bool timerQuerySupported = false;    // Timestamp queries support (OpenGL 3.3 or GL_ARB_timer_query)
+#endif
+static GpuTimes gpuTimes = { 0 };           // GPU times of last frame read back
 
 static unsigned int defaultTextureId = 0;   // Default texture used on shapes/poly drawing (required by shader)
 static unsigned int defaultVShaderId = 0;   // Default vertex shader id (used by default shader program)
@@ -810,6 +982,8 @@ static bool texDepthSupported = false;      // Depth textures supported
 static bool texMirrorClampSupported = false;// Clamp mirror wrap mode supported
 static bool texAnisoFilterSupported = false;// Anisotropic texture filtering support
 static bool debugMarkerSupported = false;   // Debug marker support
+static bool syncSupported = false;          // Fence sync objects support (OpenGL 3.2+)
+static bool bufferStorageSupported = false; // Immutable buffer storage support, persistent mapping (GL_ARB_buffer_storage)
 static int maxDepthBits = 16;               // Maximum bits for depth component
 static float maxAnisotropicLevel = 0.0f;    // Maximum anisotropy level supported (minimum is 2.0f)
 
@@ -832,6 +1006,10 @@ static bool vrStereoRender = false;         // VR stereo rendering enabled/disab
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
 static int blendMode = 0;                   // Track current blending mode
+static BatchStats batchStats = { 0 };       // Batch buffering statistics
+static RenderStats renderStats = { 0 };     // Render statistics of current frame
+static RenderStats renderStatsLast = { 0 }; // Render statistics of last completed frame
+static unsigned int renderStatsShaderId = 0; // Shader program of last draw, switches are counted when it changes
 
 // Default framebuffer size
 static int framebufferWidth = 0;            // Default framebuffer width
@@ -849,6 +1027,14 @@ static void SetShaderDefaultLocations(Shader *shader); // Bind default shader lo
 static void UnloadShaderDefault(void);      // Unload default shader
 
 static void LoadBuffersDefault(void);       // Load default internal buffers
+static void WriteVertexBlock(int offset, const float *positions, int count); // Write a block of vertex positions into current buffer
+static void LoadBufferStorage(int buffer, int index, const void *data, int size); // Load default internal buffer GPU storage
+static void WaitBufferFence(void);          // Wait for GPU to release current internal buffer (fence sync)
+static void UpdateBufferDefault(int index, const void *data, int dataSize, int bufferSize); // Update one current internal buffer
+#if defined(SUPPORT_BATCH_INTERLEAVED_2D)
+static void SetVertexAttribs2D(void);       // Set vertex attributes for interleaved 2D vertex data
+#endif
+static void SortDrawsDefault(void);         // Sort default internal buffers draw calls, grouping by texture and mode
 static void UpdateBuffersDefault(void);     // Update default internal buffers (VAOs/VBOs) with vertex data
 static void DrawBuffersDefault(void);       // Draw default internal buffers vertex data
 static void UnloadBuffersDefault(void);     // Unload default internal buffers vertex data from CPU and GPU
@@ -1070,7 +1256,7 @@ void rlBegin(int mode)
 
             else draws[drawsCounter - 1].vertexAlignment = 0;
 
-            if (rlCheckBufferLimit(draws[drawsCounter - 1].vertexAlignment)) rlglDraw();
+            if (rlCheckBufferLimit(draws[drawsCounter - 1].vertexAlignment)) rlglDrawEx(RL_FLUSH_BUFFER_FULL);
             else
             {
                 vertexData[currentBuffer].vCounter += draws[drawsCounter - 1].vertexAlignment;
@@ -1081,7 +1267,7 @@ void rlBegin(int mode)
             }
         }
 
-        if (drawsCounter >= MAX_DRAWCALL_REGISTERED) rlglDraw();
+        if (drawsCounter >= MAX_DRAWCALL_REGISTERED) rlglDrawEx(RL_FLUSH_DRAWCALLS_FULL);
 
         draws[drawsCounter - 1].mode = mode;
         draws[drawsCounter - 1].vertexCount = 0;
@@ -1102,10 +1288,18 @@ void rlEnd(void)
 
         for (int i = 0; i < addColors; i++)
         {
+#if defined(SUPPORT_BATCH_INTERLEAVED_2D)
+            Vertex2D *vertex = &vertexData[currentBuffer].vertices[vertexData[currentBuffer].cCounter];
+            vertex->r = (vertex - 1)->r;
+            vertex->g = (vertex - 1)->g;
+            vertex->b = (vertex - 1)->b;
+            vertex->a = (vertex - 1)->a;
+#else
             vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter] = vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter - 4];
             vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter + 1] = vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter - 3];
             vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter + 2] = vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter - 2];
             vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter + 3] = vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter - 1];
+#endif
             vertexData[currentBuffer].cCounter++;
         }
     }
@@ -1117,8 +1311,13 @@ void rlEnd(void)
 
         for (int i = 0; i < addTexCoords; i++)
         {
+#if defined(SUPPORT_BATCH_INTERLEAVED_2D)
+            vertexData[currentBuffer].vertices[vertexData[currentBuffer].tcCounter].u = 0;
+            vertexData[currentBuffer].vertices[vertexData[currentBuffer].tcCounter].v = 0;
+#else
             vertexData[currentBuffer].texcoords[2*vertexData[currentBuffer].tcCounter] = 0.0f;
             vertexData[currentBuffer].texcoords[2*vertexData[currentBuffer].tcCounter + 1] = 0.0f;
+#endif
             vertexData[currentBuffer].tcCounter++;
         }
     }
@@ -1138,7 +1337,7 @@ void rlEnd(void)
         // we need to call rlPopMatrix() before to recover *currentMatrix (modelview) for the next forced draw call!
         // If we have multiple matrix pushed, it will require "stackCounter" pops before launching the draw
         for (int i = stackCounter; i >= 0; i--) rlPopMatrix();
-        rlglDraw();
+        rlglDrawEx(RL_FLUSH_BUFFER_FULL);
     }
 }
 
@@ -1154,9 +1353,14 @@ void rlVertex3f(float x, float y, float z)
     // Verify that MAX_BATCH_ELEMENTS limit not reached
     if (vertexData[currentBuffer].vCounter < (MAX_BATCH_ELEMENTS*4))
     {
+#if defined(SUPPORT_BATCH_INTERLEAVED_2D)
+        vertexData[currentBuffer].vertices[vertexData[currentBuffer].vCounter].x = vec.x;
+        vertexData[currentBuffer].vertices[vertexData[currentBuffer].vCounter].y = vec.y;
+#else
         vertexData[currentBuffer].vertices[3*vertexData[currentBuffer].vCounter] = vec.x;
         vertexData[currentBuffer].vertices[3*vertexData[currentBuffer].vCounter + 1] = vec.y;
         vertexData[currentBuffer].vertices[3*vertexData[currentBuffer].vCounter + 2] = vec.z;
+#endif
         vertexData[currentBuffer].vCounter++;
 
         draws[drawsCounter - 1].vertexCount++;
@@ -1180,8 +1384,19 @@ void rlVertex2i(int x, int y)
 // NOTE: Texture coordinates are limited to QUADS only
 void rlTexCoord2f(float x, float y)
 {
+#if defined(SUPPORT_BATCH_INTERLEAVED_2D)
+    // NOTE: Texcoords are stored normalized, values out of [0..1] range (texture repeat) are clamped
+    if (x < 0.0f) x = 0.0f;
+    else if (x > 1.0f) x = 1.0f;
+    if (y < 0.0f) y = 0.0f;
+    else if (y > 1.0f) y = 1.0f;
+
+    vertexData[currentBuffer].vertices[vertexData[currentBuffer].tcCounter].u = (unsigned short)(x*65535.0f + 0.5f);
+    vertexData[currentBuffer].vertices[vertexData[currentBuffer].tcCounter].v = (unsigned short)(y*65535.0f + 0.5f);
+#else
     vertexData[currentBuffer].texcoords[2*vertexData[currentBuffer].tcCounter] = x;
     vertexData[currentBuffer].texcoords[2*vertexData[currentBuffer].tcCounter + 1] = y;
+#endif
     vertexData[currentBuffer].tcCounter++;
 }
 
@@ -1195,10 +1410,17 @@ void rlNormal3f(float x, float y, float z)
 // Define one vertex (color)
 void rlColor4ub(byte x, byte y, byte z, byte w)
 {
+#if defined(SUPPORT_BATCH_INTERLEAVED_2D)
+    vertexData[currentBuffer].vertices[vertexData[currentBuffer].cCounter].r = x;
+    vertexData[currentBuffer].vertices[vertexData[currentBuffer].cCounter].g = y;
+    vertexData[currentBuffer].vertices[vertexData[currentBuffer].cCounter].b = z;
+    vertexData[currentBuffer].vertices[vertexData[currentBuffer].cCounter].a = w;
+#else
     vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter] = x;
     vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter + 1] = y;
     vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter + 2] = z;
     vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter + 3] = w;
+#endif
     vertexData[currentBuffer].cCounter++;
 }
 
@@ -1216,6 +1438,88 @@ void rlColor3f(float x, float y, float z)
 
 #endif
 
+// Define a block of vertex for RL_QUADS or RL_TRIANGLES (no rlBegin()/rlEnd() required)
+// NOTE: Arrays provide XY position (2 float), UV texcoords (2 float) and RGBA color (4 byte) by vertex,
+// texcoords and colors can be NULL (0.0f texcoords and WHITE color are used); vertexCount must be
+// a multiple of 4 (quads) or 3 (triangles). Vertex are transformed by blocks and written directly to batch
+void rlVertexArray2f(int mode, const float *vertices, const float *texcoords, const unsigned char *colors, int vertexCount)
+{
+    int primitiveSize = (mode == RL_QUADS)? 4 : 3;
+    vertexCount -= vertexCount%primitiveSize;
+
+#if defined(GRAPHICS_API_OPENGL_11)
+    rlBegin(mode);
+    for (int i = 0; i < vertexCount; i++)
+    {
+        if (colors != NULL) rlColor4ub(colors[4*i], colors[4*i + 1], colors[4*i + 2], colors[4*i + 3]);
+        else rlColor4ub(255, 255, 255, 255);
+        if (texcoords != NULL) rlTexCoord2f(texcoords[2*i], texcoords[2*i + 1]);
+        rlVertex2f(vertices[2*i], vertices[2*i + 1]);
+    }
+    rlEnd();
+#elif defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: Every block leaves some room on the batch for rlBegin() alignment vertex and
+    // to avoid rlEnd() forced draw (that would pop the matrix stack)
+    int maxBlockCount = (MAX_BATCH_ELEMENTS*4 - 8) - (MAX_BATCH_ELEMENTS*4 - 8)%primitiveSize;
+
+    while (vertexCount > 0)
+    {
+        int count = (vertexCount < maxBlockCount)? vertexCount : maxBlockCount;
+
+        // Reserve batch space once per block
+        // NOTE: Flush resets draws to default texture, current texture is enabled again
+        if (rlCheckBufferLimit(count + 8))
+        {
+            unsigned int textureId = draws[drawsCounter - 1].textureId;
+
+            rlglDrawEx(RL_FLUSH_BUFFER_FULL);
+            rlEnableTexture(textureId);
+        }
+
+        rlBegin(mode);
+
+        int offset = vertexData[currentBuffer].vCounter;
+
+        WriteVertexBlock(offset, vertices, count);
+
+#if defined(SUPPORT_BATCH_INTERLEAVED_2D)
+        Vertex2D *vertex = vertexData[currentBuffer].vertices + offset;
+
+        for (int i = 0; i < count; i++, vertex++)
+        {
+            if (texcoords != NULL)
+            {
+                float u = texcoords[2*i], v = texcoords[2*i + 1];
+                vertex->u = (unsigned short)(((u < 0.0f)? 0.0f : (u > 1.0f)? 1.0f : u)*65535.0f + 0.5f);
+                vertex->v = (unsigned short)(((v < 0.0f)? 0.0f : (v > 1.0f)? 1.0f : v)*65535.0f + 0.5f);
+            }
+            else { vertex->u = 0; vertex->v = 0; }
+
+            if (colors != NULL) { vertex->r = colors[4*i]; vertex->g = colors[4*i + 1]; vertex->b = colors[4*i + 2]; vertex->a = colors[4*i + 3]; }
+            else { vertex->r = 255; vertex->g = 255; vertex->b = 255; vertex->a = 255; }
+        }
+#else
+        if (texcoords != NULL) memcpy(vertexData[currentBuffer].texcoords + 2*offset, texcoords, sizeof(float)*2*count);
+        else memset(vertexData[currentBuffer].texcoords + 2*offset, 0, sizeof(float)*2*count);
+
+        if (colors != NULL) memcpy(vertexData[currentBuffer].colors + 4*offset, colors, sizeof(unsigned char)*4*count);
+        else memset(vertexData[currentBuffer].colors + 4*offset, 255, sizeof(unsigned char)*4*count);
+#endif
+        vertexData[currentBuffer].vCounter = offset + count;
+        vertexData[currentBuffer].tcCounter = offset + count;
+        vertexData[currentBuffer].cCounter = offset + count;
+        draws[drawsCounter - 1].vertexCount += count;
+
+        rlEnd();
+
+        vertices += 2*count;
+        if (texcoords != NULL) texcoords += 2*count;
+        if (colors != NULL) colors += 4*count;
+        vertexCount -= count;
+    }
+#endif
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - OpenGL equivalent functions (common to 1.1, 3.3+, ES2)
 //----------------------------------------------------------------------------------
@@ -1243,7 +1547,7 @@ void rlEnableTexture(unsigned int id)
 
             else draws[drawsCounter - 1].vertexAlignment = 0;
 
-            if (rlCheckBufferLimit(draws[drawsCounter - 1].vertexAlignment)) rlglDraw();
+            if (rlCheckBufferLimit(draws[drawsCounter - 1].vertexAlignment)) rlglDrawEx(RL_FLUSH_BUFFER_FULL);
             else
             {
                 vertexData[currentBuffer].vCounter += draws[drawsCounter - 1].vertexAlignment;
@@ -1254,7 +1558,7 @@ void rlEnableTexture(unsigned int id)
             }
         }
 
-        if (drawsCounter >= MAX_DRAWCALL_REGISTERED) rlglDraw();
+        if (drawsCounter >= MAX_DRAWCALL_REGISTERED) rlglDrawEx(RL_FLUSH_DRAWCALLS_FULL);
 
         draws[drawsCounter - 1].textureId = id;
         draws[drawsCounter - 1].vertexCount = 0;
@@ -1271,7 +1575,7 @@ void rlDisableTexture(void)
 #else
     // NOTE: If quads batch limit is reached,
     // we force a draw call and next batch starts
-    if (vertexData[currentBuffer].vCounter >= (MAX_BATCH_ELEMENTS*4)) rlglDraw();
+    if (vertexData[currentBuffer].vCounter >= (MAX_BATCH_ELEMENTS*4)) rlglDrawEx(RL_FLUSH_BUFFER_FULL);
 #endif
 }
 
@@ -1456,6 +1760,8 @@ void rlUpdateBuffer(int bufferId, void *data, int dataSize)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindBuffer(GL_ARRAY_BUFFER, bufferId);
     glBufferSubData(GL_ARRAY_BUFFER, 0, dataSize, data);
+
+    renderStats.uploadedBytes += dataSize;
 #endif
 }
 
@@ -1616,8 +1922,25 @@ void rlglInit(int width, int height)
 
         // Debug marker support
         if (strcmp(extList[i], (const char *)"GL_EXT_debug_marker") == 0) debugMarkerSupported = true;
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(__APPLE__)
+        // Persistent mapped buffers support (core on OpenGL 4.4)
+        if (strcmp(extList[i], (const char *)"GL_ARB_buffer_storage") == 0) bufferStorageSupported = (glBufferStorage != NULL);
+#endif
     }
 
+#if defined(GRAPHICS_API_OPENGL_33)
+    // NOTE: Fence sync objects are core on OpenGL 3.2, not available on OpenGL 2.1 without GL_ARB_sync
+    syncSupported = (glFenceSync != NULL);
+#endif
+    // Persistent mapping requires fences to avoid overwriting data still in use by GPU
+    if (!syncSupported) bufferStorageSupported = false;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // NOTE: Timestamp queries are core on OpenGL 3.3, not available on OpenGL 2.1 without GL_ARB_timer_query
+    timerQuerySupported = (glQueryCounter != NULL);
+#endif
+
     // Free extensions pointers
     RL_FREE(extList);
 
@@ -1641,6 +1964,8 @@ void rlglInit(int width, int height)
     if (texMirrorClampSupported) TraceLog(LOG_INFO, "[EXTENSION] Mirror clamp wrap texture mode supported");
 
     if (debugMarkerSupported) TraceLog(LOG_INFO, "[EXTENSION] Debug Marker supported");
+    if (bufferStorageSupported) TraceLog(LOG_INFO, "[EXTENSION] Persistent mapped buffers supported");
+    if (timerQuerySupported) TraceLog(LOG_INFO, "[EXTENSION] GPU timer queries supported");
 
     // Initialize buffers, default shaders and default textures
     //----------------------------------------------------------
@@ -1687,6 +2012,16 @@ void rlglInit(int width, int height)
     currentMatrix = &modelview;
 #endif      // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Init GPU timer queries and begin first frame timing
+    if (timerQuerySupported)
+    {
+        for (int i = 0; i < MAX_GPU_TIMER_FRAMES; i++) glGenQueries(MAX_GPU_TIMER_QUERIES, gpuTimers[i].queries);
+
+        rlBeginGpuPass("frame");
+    }
+#endif
+
     // Initialize OpenGL default states
     //----------------------------------------------------------
     // Init state: Depth test
@@ -1733,21 +2068,261 @@ void rlglClose(void)
 
     RL_FREE(draws);
 #endif
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Unload screen readbacks pixel buffers (pending reads are discarded)
+    for (int i = 0; i < MAX_SCREEN_READBACKS; i++)
+    {
+        if (readbacks[i].fence != NULL) glDeleteSync(readbacks[i].fence);
+        if (readbacks[i].pboId != 0) glDeleteBuffers(1, &readbacks[i].pboId);
+    }
+
+    memset(readbacks, 0, sizeof(readbacks));
+    readbacksFirst = 0;
+    readbacksCounter = 0;
+
+    // Unload GPU timer queries (pending results are discarded)
+    if (timerQuerySupported)
+    {
+        for (int i = 0; i < MAX_GPU_TIMER_FRAMES; i++) glDeleteQueries(MAX_GPU_TIMER_QUERIES, gpuTimers[i].queries);
+    }
+
+    memset(gpuTimers, 0, sizeof(gpuTimers));
+    gpuTimersCurrent = 0;
+    gpuPassDepth = 0;
+    gpuPassOverflow = 0;
+#endif
 }
 
 // Update and draw internal buffers
 void rlglDraw(void)
+{
+    rlglDrawEx(RL_FLUSH_STATE);
+}
+
+// Update and draw internal buffers, flush reason is recorded for render statistics
+void rlglDrawEx(int reason)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     // Only process data if we have data to process
     if (vertexData[currentBuffer].vCounter > 0)
     {
+        TRACE_ZONE_BEGIN("rlglDraw");
+
+        renderStats.flushCount++;
+        if ((reason >= 0) && (reason < RL_FLUSH_REASONS)) renderStats.flushReasons[reason]++;
+
+        if (drawSorting) SortDrawsDefault();
+
+        rlBeginGpuPass("batch");
+
         UpdateBuffersDefault();
         DrawBuffersDefault();       // NOTE: Stereo rendering is checked inside
+
+        rlEndGpuPass();
+
+        TRACE_ZONE_END();
     }
 #endif
 }
 
+// Enable batch draw calls sorting
+// NOTE: Draw calls sharing texture and mode are grouped, a draw call is only moved before
+// previous ones if their 2D bounds do not overlap, so painter's order is kept where it matters
+void rlEnableDrawSorting(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    drawSorting = true;
+#endif
+}
+
+// Disable batch draw calls sorting
+void rlDisableDrawSorting(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    drawSorting = false;
+#endif
+}
+
+// Get internal batch buffering statistics
+BatchStats rlGetBatchStats(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    batchStats.buffersCount = MAX_BATCH_BUFFERING;
+#if defined(GRAPHICS_API_OPENGL_33)
+    batchStats.persistentMapping = (vertexData[0].mapped[0] != NULL);
+#endif
+#endif
+    return batchStats;
+}
+
+// Reset internal batch buffering statistics
+void rlResetBatchStats(void)
+{
+    BatchStats stats = { 0 };
+    batchStats = stats;
+}
+
+// Get render statistics of last completed frame
+RenderStats rlGetRenderStats(void)
+{
+    return renderStatsLast;
+}
+
+// Close current frame render statistics and start a new frame
+// NOTE: Called by EndDrawing() after last frame flush, before buffers swap
+void rlUpdateRenderStats(void)
+{
+    RenderStats stats = { 0 };
+    renderStatsLast = renderStats;
+    renderStats = stats;
+}
+
+// Begin GPU timed pass, a timestamp query is issued at current point of commands stream
+// NOTE: Passes can be nested, runs of passes with same name are added on frame results
+void rlBeginGpuPass(const char *name)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (!timerQuerySupported) return;
+
+    if (gpuPassDepth >= MAX_GPU_PASSES)
+    {
+        gpuPassOverflow++;
+        return;
+    }
+
+    GpuTimerFrame *frame = &gpuTimers[gpuTimersCurrent];
+
+    // NOTE: End queries of all open passes are reserved, if frame queries limit is reached pass is not timed
+    if ((frame->queriesCounter + 2 + gpuPassDepth) > MAX_GPU_TIMER_QUERIES)
+    {
+        gpuPassStack[gpuPassDepth++] = -1;
+        return;
+    }
+
+    GpuTimerPass *pass = &frame->passes[frame->passesCounter];
+    pass->name = name;
+    pass->begin = frame->queriesCounter;
+    pass->end = -1;
+
+    glQueryCounter(frame->queries[frame->queriesCounter++], GL_TIMESTAMP);
+
+    gpuPassStack[gpuPassDepth++] = frame->passesCounter++;
+#endif
+}
+
+// End GPU timed pass
+// NOTE: Frame pass (first pass) is only ended by rlUpdateGpuTimes()
+void rlEndGpuPass(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (gpuPassOverflow > 0)
+    {
+        gpuPassOverflow--;
+        return;
+    }
+
+    if (gpuPassDepth <= 1) return;
+
+    int index = gpuPassStack[--gpuPassDepth];
+
+    if (index >= 0)
+    {
+        GpuTimerFrame *frame = &gpuTimers[gpuTimersCurrent];
+
+        frame->passes[index].end = frame->queriesCounter;
+        glQueryCounter(frame->queries[frame->queriesCounter++], GL_TIMESTAMP);
+    }
+#endif
+}
+
+#if defined(GRAPHICS_API_OPENGL_33)
+// Read back GPU timer queries results of a frame (results must be available)
+static void ReadGpuTimes(GpuTimerFrame *frame)
+{
+    GpuTimes times = { 0 };
+    GLuint64 timestamps[MAX_GPU_TIMER_QUERIES] = { 0 };
+
+    for (int i = 0; i < frame->queriesCounter; i++) glGetQueryObjectui64v(frame->queries[i], GL_QUERY_RESULT, &timestamps[i]);
+
+    for (int i = 0; i < frame->passesCounter; i++)
+    {
+        GpuTimerPass *pass = &frame->passes[i];
+        if (pass->end < 0) continue;
+
+        float time = (float)(timestamps[pass->end] - timestamps[pass->begin])/1000000.0f;
+
+        if (i == 0)
+        {
+            times.frameTime = time;
+            continue;
+        }
+
+        int k = 0;
+        while ((k < times.passCount) && (strcmp(times.passes[k].name, pass->name) != 0)) k++;
+
+        if (k == times.passCount)
+        {
+            if (times.passCount == MAX_GPU_PASSES) continue;
+
+            times.passes[k].name = pass->name;
+            times.passCount++;
+        }
+
+        times.passes[k].count++;
+        times.passes[k].time += time;
+    }
+
+    times.ready = true;
+    times.frameDelay = MAX_GPU_TIMER_FRAMES - 1;
+    gpuTimes = times;
+}
+#endif
+
+// Close current frame GPU timing and begin next frame timing
+// NOTE: Queries issued MAX_GPU_TIMER_FRAMES - 1 frames before are read back only if GPU already
+// completed them, otherwise they are discarded, so CPU never waits for GPU results
+void rlUpdateGpuTimes(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (!timerQuerySupported) return;
+
+    // End all open passes, frame pass included
+    gpuPassOverflow = 0;
+    while (gpuPassDepth > 1) rlEndGpuPass();
+
+    GpuTimerFrame *frame = &gpuTimers[gpuTimersCurrent];
+    frame->passes[0].end = frame->queriesCounter;
+    glQueryCounter(frame->queries[frame->queriesCounter++], GL_TIMESTAMP);
+    frame->pending = true;
+    gpuPassDepth = 0;
+
+    // Reuse oldest frame slot, reading back its results if completed
+    gpuTimersCurrent = (gpuTimersCurrent + 1)%MAX_GPU_TIMER_FRAMES;
+    frame = &gpuTimers[gpuTimersCurrent];
+
+    if (frame->pending)
+    {
+        int available = 0;
+        glGetQueryObjectiv(frame->queries[frame->queriesCounter - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+
+        if (available) ReadGpuTimes(frame);
+    }
+
+    frame->queriesCounter = 0;
+    frame->passesCounter = 0;
+    frame->pending = false;
+
+    rlBeginGpuPass("frame");
+#endif
+}
+
+// Get GPU times of last frame read back
+GpuTimes rlGetGpuTimes(void)
+{
+    return gpuTimes;
+}
+
 // Returns current OpenGL version
 int rlGetVersion(void)
 {
@@ -2102,6 +2677,13 @@ unsigned int rlLoadTextureCubemap(void *data, int size, int format)
 // Update already loaded texture in GPU with new data
 // NOTE: We don't know safely if internal texture format is the expected one...
 void rlUpdateTexture(unsigned int id, int width, int height, int format, const void *data)
+{
+    rlUpdateTextureRec(id, 0, 0, width, height, format, data);
+}
+
+// Update GPU texture rectangle with new data
+// NOTE: data must hold width*height pixels (tightly packed) of provided format
+void rlUpdateTextureRec(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data)
 {
     glBindTexture(GL_TEXTURE_2D, id);
 
@@ -2110,7 +2692,9 @@ void rlUpdateTexture(unsigned int id, int width, int height, int format, const v
 
     if ((glInternalFormat != -1) && (format < COMPRESSED_DXT1_RGB))
     {
-        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, glFormat, glType, (unsigned char *)data);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, offsetX, offsetY, width, height, glFormat, glType, (unsigned char *)data);
+
+        renderStats.uploadedBytes += GetPixelDataSize(width, height, format);
     }
     else TraceLog(LOG_WARNING, "Texture format updating not supported");
 }
@@ -2521,47 +3105,59 @@ void rlUpdateMeshAt(Mesh mesh, int buffer, int num, int index)
         {
             glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[0]);
             if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*num, mesh.vertices, GL_DYNAMIC_DRAW);
-            else if (index + num >= mesh.vertexCount) break;
+            else if (index + num > mesh.vertexCount) break;
             else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*3*index, sizeof(float)*3*num, mesh.vertices);
 
+            renderStats.uploadedBytes += sizeof(float)*3*num;
+
         } break;
         case 1:     // Update texcoords (vertex texture coordinates)
         {
             glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[1]);
             if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*num, mesh.texcoords, GL_DYNAMIC_DRAW);
-            else if (index + num >= mesh.vertexCount) break;
+            else if (index + num > mesh.vertexCount) break;
             else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*2*index, sizeof(float)*2*num, mesh.texcoords);
 
+            renderStats.uploadedBytes += sizeof(float)*2*num;
+
         } break;
         case 2:     // Update normals (vertex normals)
         {
             glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[2]);
             if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*num, mesh.normals, GL_DYNAMIC_DRAW);
-            else if (index + num >= mesh.vertexCount) break;
+            else if (index + num > mesh.vertexCount) break;
             else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*3*index, sizeof(float)*3*num, mesh.normals);
 
+            renderStats.uploadedBytes += sizeof(float)*3*num;
+
         } break;
         case 3:     // Update colors (vertex colors)
         {
             glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[3]);
-            if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*num, mesh.colors, GL_DYNAMIC_DRAW);
-            else if (index + num >= mesh.vertexCount) break;
+            if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(unsigned char)*4*num, mesh.colors, GL_DYNAMIC_DRAW);
+            else if (index + num > mesh.vertexCount) break;
             else glBufferSubData(GL_ARRAY_BUFFER, sizeof(unsigned char)*4*index, sizeof(unsigned char)*4*num, mesh.colors);
 
+            renderStats.uploadedBytes += sizeof(unsigned char)*4*num;
+
         } break;
         case 4:     // Update tangents (vertex tangents)
         {
             glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[4]);
             if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*num, mesh.tangents, GL_DYNAMIC_DRAW);
-            else if (index + num >= mesh.vertexCount) break;
+            else if (index + num > mesh.vertexCount) break;
             else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*4*index, sizeof(float)*4*num, mesh.tangents);
+
+            renderStats.uploadedBytes += sizeof(float)*4*num;
         } break;
         case 5:     // Update texcoords2 (vertex second texture coordinates)
         {
             glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[5]);
             if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*num, mesh.texcoords2, GL_DYNAMIC_DRAW);
-            else if (index + num >= mesh.vertexCount) break;
+            else if (index + num > mesh.vertexCount) break;
             else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*2*index, sizeof(float)*2*num, mesh.texcoords2);
+
+            renderStats.uploadedBytes += sizeof(float)*2*num;
         } break;
         case 6:     // Update indices (triangle index buffer)
         {
@@ -2570,10 +3166,12 @@ void rlUpdateMeshAt(Mesh mesh, int buffer, int num, int index)
             glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.vboId[6]);
             if (index == 0 && num >= mesh.triangleCount)
                 glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(*indices)*num*3, indices, GL_DYNAMIC_DRAW);
-            else if (index + num >= mesh.triangleCount)
+            else if (index + num > mesh.triangleCount)
                 break;
             else
                 glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, sizeof(*indices)*index*3, sizeof(*indices)*num*3, indices);
+
+            renderStats.uploadedBytes += sizeof(*indices)*num*3;
         } break;
         default: break;
     }
@@ -2614,6 +3212,11 @@ void rlDrawMesh(Mesh mesh, Material material, Matrix transform)
         else glDrawArrays(GL_TRIANGLES, 0, mesh.vertexCount);
     rlPopMatrix();
 
+    renderStats.drawCalls++;
+    renderStats.vertexCount += mesh.vertexCount;
+    if (mesh.indices != NULL) renderStats.indexCount += mesh.triangleCount*3;
+    if (material.maps[MAP_DIFFUSE].texture.id > 0) renderStats.textureBinds++;
+
     glDisableClientState(GL_VERTEX_ARRAY);                  // Disable vertex array
     glDisableClientState(GL_TEXTURE_COORD_ARRAY);           // Disable texture coords array
     if (mesh.normals != NULL) glDisableClientState(GL_NORMAL_ARRAY);    // Disable normals array
@@ -2626,6 +3229,8 @@ void rlDrawMesh(Mesh mesh, Material material, Matrix transform)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     // Bind shader program
     glUseProgram(material.shader.id);
+    if (material.shader.id != renderStatsShaderId) renderStats.shaderSwitches++;
+    renderStatsShaderId = material.shader.id;
 
     // Matrices and other values required by shader
     //-----------------------------------------------------
@@ -2671,6 +3276,7 @@ void rlDrawMesh(Mesh mesh, Material material, Matrix transform)
             glActiveTexture(GL_TEXTURE0 + i);
             if ((i == MAP_IRRADIANCE) || (i == MAP_PREFILTER) || (i == MAP_CUBEMAP)) glBindTexture(GL_TEXTURE_CUBE_MAP, material.maps[i].texture.id);
             else glBindTexture(GL_TEXTURE_2D, material.maps[i].texture.id);
+            renderStats.textureBinds++;
 
             glUniform1i(material.shader.locs[LOC_MAP_DIFFUSE + i], i);
         }
@@ -2756,6 +3362,10 @@ void rlDrawMesh(Mesh mesh, Material material, Matrix transform)
         // Draw call!
         if (mesh.indices != NULL) glDrawElements(GL_TRIANGLES, mesh.triangleCount*3, GL_UNSIGNED_SHORT, 0); // Indexed vertices draw
         else glDrawArrays(GL_TRIANGLES, 0, mesh.vertexCount);
+
+        renderStats.drawCalls++;
+        renderStats.vertexCount += mesh.vertexCount;
+        if (mesh.indices != NULL) renderStats.indexCount += mesh.triangleCount*3;
     }
 
     // Unbind all binded texture maps
@@ -2814,7 +3424,8 @@ void rlUnloadMesh(Mesh mesh)
 // Read screen pixel data (color buffer)
 unsigned char *rlReadScreenPixels(int width, int height)
 {
-    unsigned char *screenData = (unsigned char *)RL_CALLOC(width*height*4, sizeof(unsigned char));
+    // NOTE: No need to clear transient data, glReadPixels() fills it
+    unsigned char *screenData = (unsigned char *)RL_FRAME_ALLOC(width*height*4*sizeof(unsigned char));
 
     // NOTE 1: glReadPixels returns image flipped vertically -> (0,0) is the bottom left corner of the framebuffer
     // NOTE 2: We are getting alpha channel! Be careful, it can be transparent if not cleared properly!
@@ -2835,11 +3446,112 @@ unsigned char *rlReadScreenPixels(int width, int height)
         }
     }
 
-    RL_FREE(screenData);
+    RL_FRAME_FREE(screenData);
 
     return imgData;     // NOTE: image data should be freed
 }
 
+// Queue screen pixel data read (color buffer), no CPU stall
+// NOTE: Pixels are copied by GPU into a pixel buffer object, retrieved later with rlGetScreenPixelsAsync(),
+// returns false if not supported or all readbacks are in flight, rlReadScreenPixels() should be used then
+bool rlReadScreenPixelsAsync(int width, int height)
+{
+    bool result = false;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (syncSupported && (readbacksCounter < MAX_SCREEN_READBACKS))
+    {
+        ScreenReadback *readback = &readbacks[(readbacksFirst + readbacksCounter)%MAX_SCREEN_READBACKS];
+        int size = width*height*4;
+
+        if (readback->pboId == 0) glGenBuffers(1, &readback->pboId);
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, readback->pboId);
+
+        if (readback->size != size)
+        {
+            glBufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+            readback->size = size;
+        }
+
+        // NOTE: With a pixel pack buffer bound, glReadPixels() returns immediately, data pointer is an offset
+        glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        readback->width = width;
+        readback->height = height;
+        readback->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+        readbacksCounter++;
+        result = true;
+    }
+#endif
+
+    return result;
+}
+
+// Get oldest queued screen pixel data if ready (NULL otherwise)
+// NOTE: Image is flipped vertically (same as rlReadScreenPixels()) but alpha channel is returned as read,
+// if wait is true, CPU blocks until the oldest read is completed, returned data should be freed
+unsigned char *rlGetScreenPixelsAsync(bool wait, int *width, int *height)
+{
+    unsigned char *imgData = NULL;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (readbacksCounter > 0)
+    {
+        ScreenReadback *readback = &readbacks[readbacksFirst];
+        GLenum result = glClientWaitSync(readback->fence, 0, 0);
+
+        if (wait && (result == GL_TIMEOUT_EXPIRED))
+        {
+            // NOTE: First wait flushes the command queue, so the fence is guaranteed to be signaled eventually
+            result = glClientWaitSync(readback->fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+            while (result == GL_TIMEOUT_EXPIRED) result = glClientWaitSync(readback->fence, 0, 1000000);
+        }
+
+        if (result != GL_TIMEOUT_EXPIRED)
+        {
+            int lineSize = readback->width*4;
+
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, readback->pboId);
+            unsigned char *pixels = (unsigned char *)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, readback->size, GL_MAP_READ_BIT);
+
+            if (pixels != NULL)
+            {
+                imgData = (unsigned char *)RL_MALLOC(readback->size);
+
+                // Flip image vertically, line by line
+                for (int y = 0; y < readback->height; y++) memcpy(imgData + y*lineSize, pixels + (readback->height - 1 - y)*lineSize, lineSize);
+
+                glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+
+                if (width != NULL) *width = readback->width;
+                if (height != NULL) *height = readback->height;
+            }
+            else
+            {
+                // NOTE: Read is still consumed (returning black pixels) to keep queued reads order
+                imgData = (unsigned char *)RL_CALLOC(readback->size, 1);
+                if (width != NULL) *width = readback->width;
+                if (height != NULL) *height = readback->height;
+
+                TraceLog(LOG_WARNING, "Screen pixels buffer could not be mapped");
+            }
+
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+            glDeleteSync(readback->fence);
+            readback->fence = NULL;
+            readbacksFirst = (readbacksFirst + 1)%MAX_SCREEN_READBACKS;
+            readbacksCounter--;
+        }
+    }
+#endif
+
+    return imgData;
+}
+
 // Read texture pixel data
 void *rlReadTexturePixels(Texture2D texture)
 {
@@ -3076,6 +3788,8 @@ void BeginShaderMode(Shader shader)
         rlglDraw();
         currentShader = shader;
     }
+
+    rlBeginGpuPass("shader");
 #endif
 }
 
@@ -3083,7 +3797,13 @@ void BeginShaderMode(Shader shader)
 void EndShaderMode(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    BeginShaderMode(defaultShader);
+    if (currentShader.id != defaultShader.id)
+    {
+        rlglDraw();
+        currentShader = defaultShader;
+    }
+
+    rlEndGpuPass();
 #endif
 }
 
@@ -4036,18 +4756,24 @@ static void LoadBuffersDefault(void)
     //--------------------------------------------------------------------------------------------
     for (int i = 0; i < MAX_BATCH_BUFFERING; i++)
     {
+#if defined(SUPPORT_BATCH_INTERLEAVED_2D)
+        vertexData[i].vertices = (Vertex2D *)RL_CALLOC(4*MAX_BATCH_ELEMENTS, sizeof(Vertex2D));   // 4 vertex by quad
+#else
         vertexData[i].vertices = (float *)RL_MALLOC(sizeof(float)*3*4*MAX_BATCH_ELEMENTS);        // 3 float by vertex, 4 vertex by quad
         vertexData[i].texcoords = (float *)RL_MALLOC(sizeof(float)*2*4*MAX_BATCH_ELEMENTS);       // 2 float by texcoord, 4 texcoord by quad
         vertexData[i].colors = (unsigned char *)RL_MALLOC(sizeof(unsigned char)*4*4*MAX_BATCH_ELEMENTS);  // 4 float by color, 4 colors by quad
+#endif
 #if defined(GRAPHICS_API_OPENGL_33)
         vertexData[i].indices = (unsigned int *)RL_MALLOC(sizeof(unsigned int)*6*MAX_BATCH_ELEMENTS);      // 6 int by quad (indices)
 #elif defined(GRAPHICS_API_OPENGL_ES2)
         vertexData[i].indices = (unsigned short *)RL_MALLOC(sizeof(unsigned short)*6*MAX_BATCH_ELEMENTS);  // 6 int by quad (indices)
 #endif
 
+#if !defined(SUPPORT_BATCH_INTERLEAVED_2D)
         for (int j = 0; j < (3*4*MAX_BATCH_ELEMENTS); j++) vertexData[i].vertices[j] = 0.0f;
         for (int j = 0; j < (2*4*MAX_BATCH_ELEMENTS); j++) vertexData[i].texcoords[j] = 0.0f;
         for (int j = 0; j < (4*4*MAX_BATCH_ELEMENTS); j++) vertexData[i].colors[j] = 0;
+#endif
 
         int k = 0;
 
@@ -4083,27 +4809,36 @@ static void LoadBuffersDefault(void)
             glBindVertexArray(vertexData[i].vaoId);
         }
 
+#if defined(SUPPORT_BATCH_INTERLEAVED_2D)
+        // Quads - Interleaved vertex buffer binding and attributes enable
+        // Vertex position, texcoord and color (shader-location = 0, 1, 3)
+        glGenBuffers(1, &vertexData[i].vboId[0]);
+        glBindBuffer(GL_ARRAY_BUFFER, vertexData[i].vboId[0]);
+        LoadBufferStorage(i, 0, vertexData[i].vertices, sizeof(Vertex2D)*4*MAX_BATCH_ELEMENTS);
+        SetVertexAttribs2D();
+#else
         // Quads - Vertex buffers binding and attributes enable
         // Vertex position buffer (shader-location = 0)
         glGenBuffers(1, &vertexData[i].vboId[0]);
         glBindBuffer(GL_ARRAY_BUFFER, vertexData[i].vboId[0]);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*MAX_BATCH_ELEMENTS, vertexData[i].vertices, GL_DYNAMIC_DRAW);
+        LoadBufferStorage(i, 0, vertexData[i].vertices, sizeof(float)*3*4*MAX_BATCH_ELEMENTS);
         glEnableVertexAttribArray(currentShader.locs[LOC_VERTEX_POSITION]);
         glVertexAttribPointer(currentShader.locs[LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
 
         // Vertex texcoord buffer (shader-location = 1)
         glGenBuffers(1, &vertexData[i].vboId[1]);
         glBindBuffer(GL_ARRAY_BUFFER, vertexData[i].vboId[1]);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*MAX_BATCH_ELEMENTS, vertexData[i].texcoords, GL_DYNAMIC_DRAW);
+        LoadBufferStorage(i, 1, vertexData[i].texcoords, sizeof(float)*2*4*MAX_BATCH_ELEMENTS);
         glEnableVertexAttribArray(currentShader.locs[LOC_VERTEX_TEXCOORD01]);
         glVertexAttribPointer(currentShader.locs[LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
 
         // Vertex color buffer (shader-location = 3)
         glGenBuffers(1, &vertexData[i].vboId[2]);
         glBindBuffer(GL_ARRAY_BUFFER, vertexData[i].vboId[2]);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(unsigned char)*4*4*MAX_BATCH_ELEMENTS, vertexData[i].colors, GL_DYNAMIC_DRAW);
+        LoadBufferStorage(i, 2, vertexData[i].colors, sizeof(unsigned char)*4*4*MAX_BATCH_ELEMENTS);
         glEnableVertexAttribArray(currentShader.locs[LOC_VERTEX_COLOR]);
         glVertexAttribPointer(currentShader.locs[LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+#endif
 
         // Fill index buffer
         glGenBuffers(1, &vertexData[i].vboId[3]);
@@ -4116,55 +4851,362 @@ static void LoadBuffersDefault(void)
     }
 
     TraceLog(LOG_INFO, "Internal buffers uploaded successfully (GPU)");
+    TraceLog(LOG_INFO, "Internal buffers multi-buffering: %i buffers (%s)", MAX_BATCH_BUFFERING, bufferStorageSupported? "persistent mapping" : "buffer orphaning");
 
     // Unbind the current VAO
     if (vaoSupported) glBindVertexArray(0);
     //--------------------------------------------------------------------------------------------
 }
 
+// Write a block of vertex positions (XY) into current buffer, transformed if required
+// NOTE: Transformation is computed for 4 vertex at once using SSE (if available)
+static void WriteVertexBlock(int offset, const float *positions, int count)
+{
+    Matrix mat = transformMatrix;
+    float z = currentDepth;
+    int i = 0;
+
+#if defined(RLGL_SIMD_SSE)
+    if (useTransformMatrix)
+    {
+        // Precompute constant terms (z is the same for all the block)
+        __m128 m0 = _mm_set1_ps(mat.m0), m1 = _mm_set1_ps(mat.m1), m2 = _mm_set1_ps(mat.m2);
+        __m128 m4 = _mm_set1_ps(mat.m4), m5 = _mm_set1_ps(mat.m5), m6 = _mm_set1_ps(mat.m6);
+        __m128 tx = _mm_set1_ps(mat.m8*z + mat.m12);
+        __m128 ty = _mm_set1_ps(mat.m9*z + mat.m13);
+        __m128 tz = _mm_set1_ps(mat.m10*z + mat.m14);
+        float rx[4], ry[4], rz[4];
+
+        for (; (i + 4) <= count; i += 4)
+        {
+            __m128 a = _mm_loadu_ps(positions + 2*i);           // x0 y0 x1 y1
+            __m128 b = _mm_loadu_ps(positions + 2*i + 4);       // x2 y2 x3 y3
+            __m128 x = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+            __m128 y = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+
+            _mm_storeu_ps(rx, _mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, x), _mm_mul_ps(m4, y)), tx));
+            _mm_storeu_ps(ry, _mm_add_ps(_mm_add_ps(_mm_mul_ps(m1, x), _mm_mul_ps(m5, y)), ty));
+            _mm_storeu_ps(rz, _mm_add_ps(_mm_add_ps(_mm_mul_ps(m2, x), _mm_mul_ps(m6, y)), tz));
+
+            for (int k = 0; k < 4; k++)
+            {
+#if defined(SUPPORT_BATCH_INTERLEAVED_2D)
+                vertexData[currentBuffer].vertices[offset + i + k].x = rx[k];
+                vertexData[currentBuffer].vertices[offset + i + k].y = ry[k];
+#else
+                vertexData[currentBuffer].vertices[3*(offset + i + k)] = rx[k];
+                vertexData[currentBuffer].vertices[3*(offset + i + k) + 1] = ry[k];
+                vertexData[currentBuffer].vertices[3*(offset + i + k) + 2] = rz[k];
+#endif
+            }
+        }
+    }
+#endif
+
+    // Remaining vertex (or all of them if SSE not available)
+    for (; i < count; i++)
+    {
+        Vector3 vec = { positions[2*i], positions[2*i + 1], z };
+
+        if (useTransformMatrix) vec = Vector3Transform(vec, mat);
+
+#if defined(SUPPORT_BATCH_INTERLEAVED_2D)
+        vertexData[currentBuffer].vertices[offset + i].x = vec.x;
+        vertexData[currentBuffer].vertices[offset + i].y = vec.y;
+#else
+        vertexData[currentBuffer].vertices[3*(offset + i)] = vec.x;
+        vertexData[currentBuffer].vertices[3*(offset + i) + 1] = vec.y;
+        vertexData[currentBuffer].vertices[3*(offset + i) + 2] = vec.z;
+#endif
+    }
+}
+
+// Load GPU storage for one of the default internal vertex buffers (currently bound to GL_ARRAY_BUFFER)
+// NOTE: If supported, buffer storage is immutable and persistently mapped, it requires fences for sync
+static void LoadBufferStorage(int buffer, int index, const void *data, int size)
+{
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(__APPLE__)
+    if (bufferStorageSupported)
+    {
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+        glBufferStorage(GL_ARRAY_BUFFER, size, data, flags);
+        vertexData[buffer].mapped[index] = glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags);
+
+        if (vertexData[buffer].mapped[index] != NULL) return;
+
+        // Buffer storage is immutable, just recreate the buffer and fallback to orphaning for it
+        TraceLog(LOG_WARNING, "Internal buffer could not be mapped persistently, using buffer orphaning");
+        glDeleteBuffers(1, &vertexData[buffer].vboId[index]);
+        glGenBuffers(1, &vertexData[buffer].vboId[index]);
+        glBindBuffer(GL_ARRAY_BUFFER, vertexData[buffer].vboId[index]);
+    }
+#endif
+    glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);
+}
+
+// Wait for GPU to finish reading current internal buffer before overwriting it
+// NOTE: Fence is inserted after buffer draw, it returns immediately if GPU is not behind
+static void WaitBufferFence(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    GLsync fence = vertexData[currentBuffer].fence;
+
+    if (fence == NULL) return;
+
+    GLenum result = glClientWaitSync(fence, 0, 0);
+
+    if (result == GL_TIMEOUT_EXPIRED)
+    {
+        batchStats.stallCount++;
+
+        // NOTE: Persistent mapped buffers require to block until the GPU releases the buffer,
+        // with buffer orphaning the driver provides a new storage and we just account the stall
+        if (vertexData[currentBuffer].mapped[0] != NULL)
+        {
+            double startTime = RLGL_GET_TIME();
+
+            // NOTE: First wait flushes the command queue, so the fence is guaranteed to be signaled eventually
+            result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+            while (result == GL_TIMEOUT_EXPIRED) result = glClientWaitSync(fence, 0, 1000000);
+
+            batchStats.stallTime += (RLGL_GET_TIME() - startTime);
+        }
+        else return;    // Keep fence, buffer is still in use by GPU
+    }
+
+    glDeleteSync(fence);
+    vertexData[currentBuffer].fence = NULL;
+#endif
+}
+
+#if defined(SUPPORT_BATCH_INTERLEAVED_2D)
+// Set vertex attributes for interleaved 2D vertex data (buffer currently bound to GL_ARRAY_BUFFER)
+static void SetVertexAttribs2D(void)
+{
+    glVertexAttribPointer(currentShader.locs[LOC_VERTEX_POSITION], 2, GL_FLOAT, 0, sizeof(Vertex2D), (void *)offsetof(Vertex2D, x));
+    glEnableVertexAttribArray(currentShader.locs[LOC_VERTEX_POSITION]);
+    glVertexAttribPointer(currentShader.locs[LOC_VERTEX_TEXCOORD01], 2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(Vertex2D), (void *)offsetof(Vertex2D, u));
+    glEnableVertexAttribArray(currentShader.locs[LOC_VERTEX_TEXCOORD01]);
+    glVertexAttribPointer(currentShader.locs[LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex2D), (void *)offsetof(Vertex2D, r));
+    glEnableVertexAttribArray(currentShader.locs[LOC_VERTEX_COLOR]);
+}
+#endif
+
+// Update one of the current default internal vertex buffers with data
+static void UpdateBufferDefault(int index, const void *data, int dataSize, int bufferSize)
+{
+    renderStats.uploadedBytes += dataSize;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // NOTE: Mapped memory is coherent, no need to flush it or bind the buffer
+    if (vertexData[currentBuffer].mapped[index] != NULL)
+    {
+        memcpy(vertexData[currentBuffer].mapped[index], data, dataSize);
+        return;
+    }
+#endif
+    glBindBuffer(GL_ARRAY_BUFFER, vertexData[currentBuffer].vboId[index]);
+    glBufferData(GL_ARRAY_BUFFER, bufferSize, NULL, GL_DYNAMIC_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, dataSize, data);
+}
+
+// Sort default internal buffers draw calls, grouping by texture and mode
+// NOTE: Draw calls are emitted in submission order, every emitted draw pulls forward the following draws
+// with the same state whose bounds do not overlap any of the skipped draws (XY bounds, 2D drawing).
+// Vertex data is reordered into scratch arrays so grouped draws become contiguous and are merged
+static void SortDrawsDefault(void)
+{
+    int count = drawsCounter;
+    if (draws[count - 1].vertexCount == 0) count--;     // Last draw could be still empty
+    if (count < 3) return;                              // Nothing to group
+
+    int offsets[MAX_DRAWCALL_REGISTERED] = { 0 };
+    float bounds[MAX_DRAWCALL_REGISTERED][4] = { 0 };  // Draws XY bounds: minX, minY, maxX, maxY
+    int order[MAX_DRAWCALL_REGISTERED] = { 0 };
+    bool emitted[MAX_DRAWCALL_REGISTERED] = { 0 };
+
+    // Compute draws vertex offsets and XY bounds
+    for (int i = 0, offset = 0; i < count; i++)
+    {
+        float minX = 0.0f, minY = 0.0f, maxX = 0.0f, maxY = 0.0f;
+
+        for (int v = offset; v < (offset + draws[i].vertexCount); v++)
+        {
+#if defined(SUPPORT_BATCH_INTERLEAVED_2D)
+            float x = vertexData[currentBuffer].vertices[v].x;
+            float y = vertexData[currentBuffer].vertices[v].y;
+#else
+            float x = vertexData[currentBuffer].vertices[3*v];
+            float y = vertexData[currentBuffer].vertices[3*v + 1];
+#endif
+            if ((v == offset) || (x < minX)) minX = x;
+            if ((v == offset) || (x > maxX)) maxX = x;
+            if ((v == offset) || (y < minY)) minY = y;
+            if ((v == offset) || (y > maxY)) maxY = y;
+        }
+
+        offsets[i] = offset;
+        bounds[i][0] = minX;
+        bounds[i][1] = minY;
+        bounds[i][2] = maxX;
+        bounds[i][3] = maxY;
+        offset += (draws[i].vertexCount + draws[i].vertexAlignment);
+    }
+
+    // Compute draws order, stable with respect to overlapping draws
+    int orderCount = 0;
+    int groupsCount = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (emitted[i]) continue;
+
+        order[orderCount++] = i;
+        emitted[i] = true;
+        groupsCount++;
+
+        for (int j = i + 1; j < count; j++)
+        {
+            if (emitted[j] || (draws[j].textureId != draws[i].textureId) || (draws[j].mode != draws[i].mode)) continue;
+
+            bool blocked = false;
+
+            for (int k = i + 1; k < j; k++)
+            {
+                if (!emitted[k] && (bounds[j][0] <= bounds[k][2]) && (bounds[k][0] <= bounds[j][2]) &&
+                    (bounds[j][1] <= bounds[k][3]) && (bounds[k][1] <= bounds[j][3]))
+                {
+                    blocked = true;
+                    break;
+                }
+            }
+
+            if (!blocked)
+            {
+                order[orderCount++] = j;
+                emitted[j] = true;
+            }
+        }
+    }
+
+    if (groupsCount == count) return;   // No draws could be grouped, keep submission order
+
+    // Compute required vertex count, QUADS draws must start on a multiple of 4 vertex (index processing)
+    int vCounter = 0;
+    for (int i = 0; i < count; i++)
+    {
+        if ((draws[order[i]].mode == RL_QUADS) && ((i == 0) || (draws[order[i - 1]].mode != RL_QUADS) ||
+            (draws[order[i - 1]].textureId != draws[order[i]].textureId))) vCounter += (4 - vCounter%4)%4;
+        vCounter += draws[order[i]].vertexCount;
+    }
+
+    if (vCounter > (MAX_BATCH_ELEMENTS*4)) return;      // Not enough space for alignment, keep submission order
+
+    if (sortData.vertices == NULL)
+    {
+#if defined(SUPPORT_BATCH_INTERLEAVED_2D)
+        sortData.vertices = (Vertex2D *)RL_CALLOC(4*MAX_BATCH_ELEMENTS, sizeof(Vertex2D));
+#else
+        sortData.vertices = (float *)RL_CALLOC(3*4*MAX_BATCH_ELEMENTS, sizeof(float));
+        sortData.texcoords = (float *)RL_CALLOC(2*4*MAX_BATCH_ELEMENTS, sizeof(float));
+        sortData.colors = (unsigned char *)RL_CALLOC(4*4*MAX_BATCH_ELEMENTS, sizeof(unsigned char));
+#endif
+    }
+
+    // Copy vertex data in draws order and merge contiguous draws with same state
+    DrawCall sorted[MAX_DRAWCALL_REGISTERED] = { 0 };
+    int sortedCounter = 0;
+    vCounter = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        DrawCall draw = draws[order[i]];
+
+        if ((sortedCounter > 0) && (sorted[sortedCounter - 1].mode == draw.mode) && (sorted[sortedCounter - 1].textureId == draw.textureId))
+        {
+            sorted[sortedCounter - 1].vertexCount += draw.vertexCount;
+        }
+        else
+        {
+            if ((draw.mode == RL_QUADS) && (sortedCounter > 0))
+            {
+                sorted[sortedCounter - 1].vertexAlignment = (4 - vCounter%4)%4;
+                vCounter += sorted[sortedCounter - 1].vertexAlignment;
+            }
+
+            sorted[sortedCounter] = draw;
+            sorted[sortedCounter].vertexAlignment = 0;
+            sortedCounter++;
+        }
+
+#if defined(SUPPORT_BATCH_INTERLEAVED_2D)
+        memcpy(sortData.vertices + vCounter, vertexData[currentBuffer].vertices + offsets[order[i]], sizeof(Vertex2D)*draw.vertexCount);
+#else
+        memcpy(sortData.vertices + 3*vCounter, vertexData[currentBuffer].vertices + 3*offsets[order[i]], sizeof(float)*3*draw.vertexCount);
+        memcpy(sortData.texcoords + 2*vCounter, vertexData[currentBuffer].texcoords + 2*offsets[order[i]], sizeof(float)*2*draw.vertexCount);
+        memcpy(sortData.colors + 4*vCounter, vertexData[currentBuffer].colors + 4*offsets[order[i]], sizeof(unsigned char)*4*draw.vertexCount);
+#endif
+        vCounter += draw.vertexCount;
+    }
+
+    // Swap scratch arrays with current buffer arrays
+    DynamicBuffer temp = vertexData[currentBuffer];
+    vertexData[currentBuffer].vertices = sortData.vertices;
+    sortData.vertices = temp.vertices;
+#if !defined(SUPPORT_BATCH_INTERLEAVED_2D)
+    vertexData[currentBuffer].texcoords = sortData.texcoords;
+    vertexData[currentBuffer].colors = sortData.colors;
+    sortData.texcoords = temp.texcoords;
+    sortData.colors = temp.colors;
+#endif
+    vertexData[currentBuffer].vCounter = vCounter;
+    vertexData[currentBuffer].tcCounter = vCounter;
+    vertexData[currentBuffer].cCounter = vCounter;
+
+    for (int i = 0; i < sortedCounter; i++) draws[i] = sorted[i];
+    drawsCounter = sortedCounter;
+}
+
 // Update default internal buffers (VAOs/VBOs) with vertex array data
 // NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
+// NOTE: Buffers are updated using buffer orphaning (a new storage is provided by the driver if GPU is still
+// reading previous data) or copying into persistently mapped memory (after waiting for the buffer fence)
 // TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (change flag required)
 static void UpdateBuffersDefault(void)
 {
     // Update vertex buffers data
     if (vertexData[currentBuffer].vCounter > 0)
     {
+        double startTime = RLGL_GET_TIME();
+
+        WaitBufferFence();
+
         // Activate elements VAO
         if (vaoSupported) glBindVertexArray(vertexData[currentBuffer].vaoId);
 
+        // NOTE: glBufferData() with NULL pointer orphans previous storage, so glBufferSubData()
+        // does not need to wait (stall) for the GPU to finish with the previous data
+
+#if defined(SUPPORT_BATCH_INTERLEAVED_2D)
+        // Interleaved vertex buffer (positions, texture coordinates and colors)
+        UpdateBufferDefault(0, vertexData[currentBuffer].vertices, sizeof(Vertex2D)*vertexData[currentBuffer].vCounter, sizeof(Vertex2D)*4*MAX_BATCH_ELEMENTS);
+#else
         // Vertex positions buffer
-        glBindBuffer(GL_ARRAY_BUFFER, vertexData[currentBuffer].vboId[0]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(float)*3*vertexData[currentBuffer].vCounter, vertexData[currentBuffer].vertices);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*MAX_BATCH_ELEMENTS, vertexData[currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
+        UpdateBufferDefault(0, vertexData[currentBuffer].vertices, sizeof(float)*3*vertexData[currentBuffer].vCounter, sizeof(float)*3*4*MAX_BATCH_ELEMENTS);
 
         // Texture coordinates buffer
-        glBindBuffer(GL_ARRAY_BUFFER, vertexData[currentBuffer].vboId[1]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(float)*2*vertexData[currentBuffer].vCounter, vertexData[currentBuffer].texcoords);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*MAX_BATCH_ELEMENTS, vertexData[currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
+        UpdateBufferDefault(1, vertexData[currentBuffer].texcoords, sizeof(float)*2*vertexData[currentBuffer].vCounter, sizeof(float)*2*4*MAX_BATCH_ELEMENTS);
 
         // Colors buffer
-        glBindBuffer(GL_ARRAY_BUFFER, vertexData[currentBuffer].vboId[2]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(unsigned char)*4*vertexData[currentBuffer].vCounter, vertexData[currentBuffer].colors);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*MAX_BATCH_ELEMENTS, vertexData[currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
-
-        // NOTE: glMapBuffer() causes sync issue.
-        // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job.
-        // To avoid waiting (idle), you can call first glBufferData() with NULL pointer before glMapBuffer().
-        // If you do that, the previous data in PBO will be discarded and glMapBuffer() returns a new
-        // allocated pointer immediately even if GPU is still working with the previous data.
-
-        // Another option: map the buffer object into client's memory
-        // Probably this code could be moved somewhere else...
-        // vertexData[currentBuffer].vertices = (float *)glMapBuffer(GL_ARRAY_BUFFER, GL_READ_WRITE);
-        // if (vertexData[currentBuffer].vertices)
-        // {
-            // Update vertex data
-        // }
-        // glUnmapBuffer(GL_ARRAY_BUFFER);
+        UpdateBufferDefault(2, vertexData[currentBuffer].colors, sizeof(unsigned char)*4*vertexData[currentBuffer].vCounter, sizeof(unsigned char)*4*4*MAX_BATCH_ELEMENTS);
+#endif
 
         // Unbind the current VAO
         if (vaoSupported) glBindVertexArray(0);
+
+        batchStats.flushCount++;
+        batchStats.uploadTime += (RLGL_GET_TIME() - startTime);
     }
 }
 
@@ -4190,6 +5232,8 @@ static void DrawBuffersDefault(void)
         {
             // Set current shader and upload current MVP matrix
             glUseProgram(currentShader.id);
+            if (currentShader.id != renderStatsShaderId) renderStats.shaderSwitches++;
+            renderStatsShaderId = currentShader.id;
 
             // Create modelview-projection matrix
             Matrix matMVP = MatrixMultiply(modelview, projection);
@@ -4209,6 +5253,11 @@ static void DrawBuffersDefault(void)
             if (vaoSupported) glBindVertexArray(vertexData[currentBuffer].vaoId);
             else
             {
+#if defined(SUPPORT_BATCH_INTERLEAVED_2D)
+                // Bind vertex attribs: position, texcoord, color (shader-location = 0, 1, 3)
+                glBindBuffer(GL_ARRAY_BUFFER, vertexData[currentBuffer].vboId[0]);
+                SetVertexAttribs2D();
+#else
                 // Bind vertex attrib: position (shader-location = 0)
                 glBindBuffer(GL_ARRAY_BUFFER, vertexData[currentBuffer].vboId[0]);
                 glVertexAttribPointer(currentShader.locs[LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
@@ -4223,23 +5272,40 @@ static void DrawBuffersDefault(void)
                 glBindBuffer(GL_ARRAY_BUFFER, vertexData[currentBuffer].vboId[2]);
                 glVertexAttribPointer(currentShader.locs[LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
                 glEnableVertexAttribArray(currentShader.locs[LOC_VERTEX_COLOR]);
-
+#endif
                 glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vertexData[currentBuffer].vboId[3]);
             }
 
             glActiveTexture(GL_TEXTURE0);
 
+            unsigned int boundTextureId = 0;
+
             for (int i = 0; i < drawsCounter; i++)
             {
-                glBindTexture(GL_TEXTURE_2D, draws[i].textureId);
+                // NOTE: Consecutive draws sharing texture (i.e. different mode) do not rebind it
+                if ((i == 0) || (draws[i].textureId != boundTextureId))
+                {
+                    glBindTexture(GL_TEXTURE_2D, draws[i].textureId);
+                    boundTextureId = draws[i].textureId;
+                    renderStats.textureBinds++;
+                }
 
                 // TODO: Find some way to bind additional textures --> Use global texture IDs? Register them on draw[i]?
                 //if (currentShader->locs[LOC_MAP_SPECULAR] > 0) { glActiveTexture(GL_TEXTURE1); glBindTexture(GL_TEXTURE_2D, textureUnit1_id); }
                 //if (currentShader->locs[LOC_MAP_SPECULAR] > 0) { glActiveTexture(GL_TEXTURE2); glBindTexture(GL_TEXTURE_2D, textureUnit2_id); }
 
+                if (draws[i].vertexCount > 0)
+                {
+                    batchStats.drawCallsCount++;
+                    renderStats.drawCalls++;
+                    renderStats.vertexCount += draws[i].vertexCount;
+                }
+
                 if ((draws[i].mode == RL_LINES) || (draws[i].mode == RL_TRIANGLES)) glDrawArrays(draws[i].mode, vertexOffset, draws[i].vertexCount);
                 else
                 {
+                    renderStats.indexCount += draws[i].vertexCount/4*6;
+
 #if defined(GRAPHICS_API_OPENGL_33)
                     // We need to define the number of indices to be processed: quadsCount*6
                     // NOTE: The final parameter tells the GPU the offset in bytes from the
@@ -4289,6 +5355,15 @@ static void DrawBuffersDefault(void)
 
     drawsCounter = 1;
 
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Insert a fence to know when GPU has finished reading this buffer
+    if (syncSupported)
+    {
+        if (vertexData[currentBuffer].fence != NULL) glDeleteSync(vertexData[currentBuffer].fence);
+        vertexData[currentBuffer].fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+#endif
+
     // Change to next buffer in the list
     currentBuffer++;
     if (currentBuffer >= MAX_BATCH_BUFFERING) currentBuffer = 0;
@@ -4308,6 +5383,22 @@ static void UnloadBuffersDefault(void)
 
     for (int i = 0; i < MAX_BATCH_BUFFERING; i++)
     {
+#if defined(GRAPHICS_API_OPENGL_33)
+        // Unmap persistent mapped buffers and delete fences
+        for (int k = 0; k < 3; k++)
+        {
+            if (vertexData[i].mapped[k] != NULL)
+            {
+                glBindBuffer(GL_ARRAY_BUFFER, vertexData[i].vboId[k]);
+                glUnmapBuffer(GL_ARRAY_BUFFER);
+                vertexData[i].mapped[k] = NULL;
+            }
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        if (vertexData[i].fence != NULL) glDeleteSync(vertexData[i].fence);
+        vertexData[i].fence = NULL;
+#endif
         // Delete VBOs from GPU (VRAM)
         glDeleteBuffers(1, &vertexData[i].vboId[0]);
         glDeleteBuffers(1, &vertexData[i].vboId[1]);
@@ -4319,10 +5410,19 @@ static void UnloadBuffersDefault(void)
 
         // Free vertex arrays memory from CPU (RAM)
         RL_FREE(vertexData[i].vertices);
+#if !defined(SUPPORT_BATCH_INTERLEAVED_2D)
         RL_FREE(vertexData[i].texcoords);
         RL_FREE(vertexData[i].colors);
+#endif
         RL_FREE(vertexData[i].indices);
     }
+
+    // Free draw calls sorting scratch arrays (if used)
+    RL_FREE(sortData.vertices);
+#if !defined(SUPPORT_BATCH_INTERLEAVED_2D)
+    RL_FREE(sortData.texcoords);
+    RL_FREE(sortData.colors);
+#endif
 }
 
 // Renders a 1x1 XY quad in NDC
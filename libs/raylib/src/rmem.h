@@ -1,11 +1,12 @@
 /**********************************************************************************************
 *
-*   rmem - raylib memory pool and objects pool
+*   rmem - raylib memory pool, objects pool and frame arena
 *
 *   A quick, efficient, and minimal free list and stack-based allocator
 *
 *   PURPOSE:
 *     - A quicker, efficient memory allocator alternative to 'malloc' and friends.
+*     - Constant time allocation and free (segregated size classes), free blocks coalesced on free.
 *     - Reduce the possibilities of memory leaks for beginner developers using Raylib.
 *     - Being able to flexibly range check memory if necessary.
 *
@@ -43,6 +44,7 @@
 
 #include <inttypes.h>
 #include <stdbool.h>
+#include <stddef.h>         // Required for: size_t, offsetof()
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -60,30 +62,35 @@
 //----------------------------------------------------------------------------------
 
 // Memory Pool
+// NOTE: Free blocks are kept in segregated lists by size class (two-level, TLSF-like), first level is
+// the power of two of the block size and second level splits it in MEMPOOL_SL_COUNT linear classes
+#if (UINTPTR_MAX > 0xFFFFFFFF)
+    #define MEMPOOL_ALIGN_BITS  4       // Allocations aligned to 16 bytes (64-bit)
+#else
+    #define MEMPOOL_ALIGN_BITS  3       // Allocations aligned to 8 bytes (32-bit)
+#endif
+#define MEMPOOL_SL_BITS         4
+#define MEMPOOL_SL_COUNT        (1 << MEMPOOL_SL_BITS)
+#define MEMPOOL_FL_COUNT        32
+
 typedef struct MemNode MemNode;
 struct MemNode {
-    size_t size;
-    MemNode *next, *prev;
+    MemNode *prevPhys;          // Previous block in pool memory, NULL for first block
+    size_t size;                // Block size (header included), lowest bit set if block is free
+    MemNode *next, *prev;       // Free list links, only valid on free blocks (overlap allocated memory)
 };
 
-typedef struct AllocList {
-    MemNode *head, *tail;
-    size_t len, maxNodes;
-    bool autoDefrag : 1;
-} AllocList;
-
 typedef struct Stack {
     uint8_t *mem, *base;
     size_t size;
 } Stack;
 
-#define MEMPOOL_BUCKET_SIZE    8
-#define MEMPOOL_BUCKET_BITS    3
-
 typedef struct MemPool {
-    AllocList freeList;
-    Stack stack;
-    MemNode *buckets[MEMPOOL_BUCKET_SIZE];
+    Stack stack;                // Pool memory, base points to the sentinel block at the end
+    size_t freeMemory;          // Free blocks memory in bytes (headers included)
+    uint32_t flBitmap;          // First level classes with free blocks
+    uint32_t slBitmap[MEMPOOL_FL_COUNT];    // Second level classes with free blocks (per first level)
+    MemNode *freeLists[MEMPOOL_FL_COUNT][MEMPOOL_SL_COUNT];
 } MemPool;
 
 // Object Pool
@@ -92,6 +99,25 @@ typedef struct ObjPool {
     size_t objSize, freeBlocks;
 } ObjPool;
 
+// Shared Object Pool, fixed-size objects allocated and freed from any thread (lock-free)
+// NOTE: Every thread keeps a cache of free objects, refilled from (and spilled to) a global free list,
+// objects can be freed on a different thread than the allocating one
+#define SHARED_OBJPOOL_MAX_THREADS  16      // Threads with a cache, other threads use global free list
+#define SHARED_OBJPOOL_CACHE_SIZE   32      // Free objects per thread cache, half moved on refill/spill
+
+typedef struct ObjPoolCache {
+    uint32_t head;              // First free object index (UINT32_MAX if empty)
+    uint32_t count;             // Free objects in cache
+    uint8_t padding[56];        // Keep every thread cache in its own cache line
+} ObjPoolCache;
+
+typedef struct SharedObjPool {
+    uint8_t *mem;
+    size_t objSize, len;
+    volatile uint64_t freeHead; // Global free list: first object index (low 32 bits), ABA tag (high 32 bits)
+    ObjPoolCache caches[SHARED_OBJPOOL_MAX_THREADS];
+} SharedObjPool;
+
 
 // Double-Ended Stack aka Deque
 typedef struct BiStack {
@@ -99,6 +125,13 @@ typedef struct BiStack {
     size_t size;
 } BiStack;
 
+// Frame Arena, linear allocator reset once per frame (front of a BiStack)
+// NOTE: Freeing the last allocation rewinds the arena, so LIFO temporaries reuse memory
+typedef struct FrameArena {
+    BiStack stack;
+    size_t peak;
+} FrameArena;
+
 #if defined(__cplusplus)
 extern "C" {            // Prevents name mangling of functions
 #endif
@@ -131,6 +164,16 @@ RMEMAPI void *ObjPoolAlloc(ObjPool *objpool);
 RMEMAPI void ObjPoolFree(ObjPool *objpool, void *ptr);
 RMEMAPI void ObjPoolCleanUp(ObjPool *objpool, void **ptrref);
 
+//------------------------------------------------------------------------------------
+// Functions Declaration - Shared Object Pool
+//------------------------------------------------------------------------------------
+RMEMAPI SharedObjPool *CreateSharedObjPool(size_t objsize, size_t len);
+RMEMAPI void DestroySharedObjPool(SharedObjPool *objpool);
+
+RMEMAPI void *SharedObjPoolAlloc(SharedObjPool *objpool);
+RMEMAPI void SharedObjPoolFree(SharedObjPool *objpool, void *ptr);
+RMEMAPI void SharedObjPoolFlush(SharedObjPool *objpool);
+
 //------------------------------------------------------------------------------------
 // Functions Declaration - Double-Ended Stack
 //------------------------------------------------------------------------------------
@@ -147,6 +190,20 @@ RMEMAPI void BiStackResetAll(BiStack *destack);
 
 RMEMAPI intptr_t BiStackMargins(BiStack destack);
 
+//------------------------------------------------------------------------------------
+// Functions Declaration - Frame Arena
+//------------------------------------------------------------------------------------
+RMEMAPI FrameArena CreateFrameArena(size_t bytes);
+RMEMAPI FrameArena CreateFrameArenaFromBuffer(void *buf, size_t bytes);
+RMEMAPI void DestroyFrameArena(FrameArena *arena);
+
+RMEMAPI void *FrameArenaAlloc(FrameArena *arena, size_t bytes);
+RMEMAPI bool FrameArenaFree(FrameArena *arena, void *ptr);
+RMEMAPI bool FrameArenaOwns(FrameArena arena, const void *ptr);
+RMEMAPI void FrameArenaReset(FrameArena *arena);
+
+RMEMAPI size_t GetFrameArenaUsedMemory(FrameArena arena);
+
 #ifdef __cplusplus
 }
 #endif
@@ -162,8 +219,8 @@ RMEMAPI intptr_t BiStackMargins(BiStack destack);
 #if defined(RMEM_IMPLEMENTATION)
 
 #include <stdio.h>          // Required for:
-#include <stdlib.h>         // Required for:
-#include <string.h>         // Required for:
+#include <stdlib.h>         // Required for: malloc(), free()
+#include <string.h>         // Required for: memset(), memcpy()
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -177,10 +234,20 @@ RMEMAPI intptr_t BiStackMargins(BiStack destack);
     #endif
 #endif
 
+#if defined(_MSC_VER)
+    #include <intrin.h>     // Required for: _InterlockedCompareExchange64(), _InterlockedIncrement()
+    #define RMEM_THREAD_LOCAL   __declspec(thread)
+#else
+    #define RMEM_THREAD_LOCAL   __thread
+#endif
+
+#define SHARED_OBJPOOL_EMPTY    UINT32_MAX
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// ...
+static volatile long rmemThreadCount = 0;               // Threads that used a shared object pool
+static RMEM_THREAD_LOCAL int rmemThreadIndex = -1;      // Calling thread index (shared object pools caches)
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
@@ -190,6 +257,153 @@ static inline size_t __AlignSize(const size_t size, const size_t align)
     return (size + (align - 1)) & -align;
 }
 
+// Memory pool blocks layout
+// NOTE: Block header is two words, so it keeps allocations aligned to MEMPOOL_ALIGN
+#define MEMPOOL_ALIGN           ((size_t)1 << MEMPOOL_ALIGN_BITS)
+#define MEMPOOL_HEADER_SIZE     offsetof(MemNode, next)
+#define MEMPOOL_MIN_BLOCK       sizeof(MemNode)
+#define MEMPOOL_SMALL_BLOCK     ((size_t)1 << (MEMPOOL_SL_BITS + MEMPOOL_ALIGN_BITS))
+#define MEMPOOL_BLOCK_FREE      ((size_t)1)
+
+// Memory pool block size without free flag
+static inline size_t __MemNodeSize(const MemNode *const node)
+{
+    return node->size & ~MEMPOOL_BLOCK_FREE;
+}
+
+// Next block in pool memory (sentinel block for the last block)
+static inline MemNode *__MemNodeNext(const MemNode *const node)
+{
+    return (MemNode *)((uint8_t *)node + __MemNodeSize(node));
+}
+
+// Index of highest bit set, value must not be 0
+static inline int __FindLastSet(const size_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (int)(sizeof(unsigned long long)*8 - 1) - __builtin_clzll((unsigned long long)value);
+#else
+    int bit = 0;
+    for (size_t v = value; v > 1; v >>= 1) bit++;
+    return bit;
+#endif
+}
+
+// Index of lowest bit set, value must not be 0
+static inline int __FindFirstSet(const uint32_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(value);
+#else
+    int bit = 0;
+    for (uint32_t v = value; (v & 1) == 0; v >>= 1) bit++;
+    return bit;
+#endif
+}
+
+// Get size class (first and second level) of a block size
+static inline void __MemPoolMapping(const size_t size, int *const fl, int *const sl)
+{
+    if (size < MEMPOOL_SMALL_BLOCK)
+    {
+        *fl = 0;
+        *sl = (int)(size >> MEMPOOL_ALIGN_BITS);
+    }
+    else
+    {
+        const int FLS = __FindLastSet(size);
+        *sl = (int)(size >> (FLS - MEMPOOL_SL_BITS)) ^ MEMPOOL_SL_COUNT;
+        *fl = FLS - (MEMPOOL_SL_BITS + MEMPOOL_ALIGN_BITS) + 1;
+    }
+}
+
+static void __MemPoolInsertFree(MemPool *const mempool, MemNode *const node)
+{
+    int fl = 0, sl = 0;
+    __MemPoolMapping(__MemNodeSize(node), &fl, &sl);
+
+    node->size |= MEMPOOL_BLOCK_FREE;
+    node->prev = NULL;
+    node->next = mempool->freeLists[fl][sl];
+    if (node->next != NULL) node->next->prev = node;
+    mempool->freeLists[fl][sl] = node;
+
+    mempool->flBitmap |= (1U << fl);
+    mempool->slBitmap[fl] |= (1U << sl);
+    mempool->freeMemory += __MemNodeSize(node);
+}
+
+static void __MemPoolRemoveFree(MemPool *const mempool, MemNode *const node)
+{
+    int fl = 0, sl = 0;
+    __MemPoolMapping(__MemNodeSize(node), &fl, &sl);
+
+    if (node->prev != NULL) node->prev->next = node->next;
+    else
+    {
+        mempool->freeLists[fl][sl] = node->next;
+
+        if (node->next == NULL)
+        {
+            mempool->slBitmap[fl] &= ~(1U << sl);
+            if (mempool->slBitmap[fl] == 0) mempool->flBitmap &= ~(1U << fl);
+        }
+    }
+    if (node->next != NULL) node->next->prev = node->prev;
+
+    node->size &= ~MEMPOOL_BLOCK_FREE;
+    mempool->freeMemory -= __MemNodeSize(node);
+}
+
+// Split block if remaining memory fits another block, remaining block is added to free lists
+static void __MemPoolSplit(MemPool *const mempool, MemNode *const node, const size_t size)
+{
+    const size_t NODE_SIZE = __MemNodeSize(node);
+
+    if (NODE_SIZE >= (size + MEMPOOL_MIN_BLOCK))
+    {
+        MemNode *const rest = (MemNode *)((uint8_t *)node + size);
+        rest->prevPhys = node;
+        rest->size = NODE_SIZE - size;
+        __MemNodeNext(rest)->prevPhys = rest;
+
+        node->size = size | (node->size & MEMPOOL_BLOCK_FREE);
+
+        // NOTE: Block after the remaining one is allocated (free blocks are always coalesced)
+        __MemPoolInsertFree(mempool, rest);
+    }
+}
+
+// Init pool memory as a single free block, followed by an allocated sentinel block
+static void __MemPoolInit(MemPool *const mempool)
+{
+    mempool->freeMemory = 0;
+    mempool->flBitmap = 0;
+    memset(mempool->slBitmap, 0, sizeof(mempool->slBitmap));
+    memset(mempool->freeLists, 0, sizeof(mempool->freeLists));
+
+    uint8_t *const start = (uint8_t *)__AlignSize((uintptr_t)mempool->stack.mem, MEMPOOL_ALIGN);
+    uint8_t *const end = (uint8_t *)(((uintptr_t)mempool->stack.mem + mempool->stack.size) & -MEMPOOL_ALIGN) - MEMPOOL_HEADER_SIZE;
+    size_t size = (size_t)(end - start);
+#if (UINTPTR_MAX > 0xFFFFFFFF)
+    // Biggest block size class available (first level classes limit), bigger pools are truncated
+    const size_t MAX_BLOCK_SIZE = ((size_t)1 << (MEMPOOL_FL_COUNT + MEMPOOL_SL_BITS + MEMPOOL_ALIGN_BITS - 1)) - MEMPOOL_ALIGN;
+    if (size > MAX_BLOCK_SIZE) size = MAX_BLOCK_SIZE;
+#endif
+
+    MemNode *const first = (MemNode *)start;
+    first->prevPhys = NULL;
+    first->size = size;
+
+    mempool->stack.base = start + size;
+
+    MemNode *const sentinel = (MemNode *)mempool->stack.base;
+    sentinel->prevPhys = first;
+    sentinel->size = 0UL;
+
+    __MemPoolInsertFree(mempool, first);
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Memory Pool
 //----------------------------------------------------------------------------------
@@ -198,21 +412,20 @@ MemPool CreateMemPool(const size_t size)
 {
     MemPool mempool = { 0 };
 
-    if (size == 0UL) return mempool;
+    if (size < (MEMPOOL_MIN_BLOCK + 2*MEMPOOL_ALIGN)) return mempool;
     else
     {
-        // Align the mempool size to at least the size of an alloc node.
         mempool.stack.size = size;
         mempool.stack.mem = malloc(mempool.stack.size*sizeof *mempool.stack.mem);
 
-        if (mempool.stack.mem==NULL)
+        if (mempool.stack.mem == NULL)
         {
             mempool.stack.size = 0UL;
             return mempool;
         }
         else
         {
-            mempool.stack.base = mempool.stack.mem + mempool.stack.size;
+            __MemPoolInit(&mempool);
             return mempool;
         }
     }
@@ -222,12 +435,12 @@ MemPool CreateMemPoolFromBuffer(void *buf, const size_t size)
 {
     MemPool mempool = { 0 };
 
-    if ((size == 0UL) || (buf == NULL) || (size <= sizeof(MemNode))) return mempool;
+    if ((buf == NULL) || (size < (MEMPOOL_MIN_BLOCK + 3*MEMPOOL_ALIGN))) return mempool;
     else
     {
         mempool.stack.size = size;
         mempool.stack.mem = buf;
-        mempool.stack.base = mempool.stack.mem + mempool.stack.size;
+        __MemPoolInit(&mempool);
         return mempool;
     }
 }
@@ -244,83 +457,49 @@ void DestroyMemPool(MemPool *const mempool)
 
 void *MemPoolAlloc(MemPool *const mempool, const size_t size)
 {
-    if ((mempool == NULL) || (size == 0UL) || (size > mempool->stack.size)) return NULL;
+    if ((mempool == NULL) || (mempool->stack.mem == NULL) || (size == 0UL) || (size > mempool->freeMemory)) return NULL;
     else
     {
-        MemNode *new_mem = NULL;
-        const size_t ALLOC_SIZE = __AlignSize(size + sizeof *new_mem, sizeof(intptr_t));
-        const size_t BUCKET_INDEX = (ALLOC_SIZE >> MEMPOOL_BUCKET_BITS) - 1;
+        size_t ALLOC_SIZE = __AlignSize(size + MEMPOOL_HEADER_SIZE, MEMPOOL_ALIGN);
+        if (ALLOC_SIZE < MEMPOOL_MIN_BLOCK) ALLOC_SIZE = MEMPOOL_MIN_BLOCK;
 
-        // If the size is small enough, let's check if our buckets has a fitting memory block.
-        if (BUCKET_INDEX < MEMPOOL_BUCKET_SIZE && mempool->buckets[BUCKET_INDEX] != NULL && mempool->buckets[BUCKET_INDEX]->size >= ALLOC_SIZE)
-        {
-            new_mem = mempool->buckets[BUCKET_INDEX];
-            mempool->buckets[BUCKET_INDEX] = mempool->buckets[BUCKET_INDEX]->next;
-            if( mempool->buckets[BUCKET_INDEX] != NULL )
-                mempool->buckets[BUCKET_INDEX]->prev = NULL;
-        }
-        else if (mempool->freeList.head != NULL)
-        {
-            const size_t MEM_SPLIT_THRESHOLD = 16;
+        // Round size up to next class, so any block in the class fits the allocation (good fit)
+        size_t searchSize = ALLOC_SIZE;
+        if (searchSize >= MEMPOOL_SMALL_BLOCK) searchSize += ((size_t)1 << (__FindLastSet(searchSize) - MEMPOOL_SL_BITS)) - 1;
 
-            // If the freelist is valid, let's allocate FROM the freelist then!
-            for (MemNode *inode = mempool->freeList.head; inode != NULL; inode = inode->next)
-            {
-                if (inode->size < ALLOC_SIZE) continue;
-                else if (inode->size <= (ALLOC_SIZE + MEM_SPLIT_THRESHOLD))
-                {
-                    // Close in size - reduce fragmentation by not splitting.
-                    new_mem = inode;
-                    (inode->prev != NULL)? (inode->prev->next = inode->next) : (mempool->freeList.head = inode->next);
-                    (inode->next != NULL)? (inode->next->prev = inode->prev) : (mempool->freeList.tail = inode->prev);
-
-                    if (mempool->freeList.head != NULL) mempool->freeList.head->prev = NULL;
-                    else mempool->freeList.tail = NULL;
-
-                    if (mempool->freeList.tail != NULL) mempool->freeList.tail->next = NULL;
-                    mempool->freeList.len--;
-                    break;
-                }
-                else
-                {
-                    // Split the memory chunk.
-                    new_mem = (MemNode *)((uint8_t *)inode + (inode->size - ALLOC_SIZE));
-                    inode->size -= ALLOC_SIZE;
-                    new_mem->size = ALLOC_SIZE;
-                    break;
-                }
-            }
-        }
+        int fl = 0, sl = 0;
+        __MemPoolMapping(searchSize, &fl, &sl);
+        if (fl >= MEMPOOL_FL_COUNT) return NULL;
 
-        if (new_mem == NULL)
+        // Find first non-empty class at least as big as requested one
+        uint32_t slMap = mempool->slBitmap[fl] & (~0U << sl);
+        if (slMap == 0)
         {
-            // not enough memory to support the size!
-            if ((mempool->stack.base - ALLOC_SIZE) < mempool->stack.mem) return NULL;
-            else
-            {
-                // Couldn't allocate from a freelist, allocate from available mempool.
-                // Subtract allocation size from the mempool.
-                mempool->stack.base -= ALLOC_SIZE;
+            const uint32_t flMap = (fl + 1 < MEMPOOL_FL_COUNT)? (mempool->flBitmap & (~0U << (fl + 1))) : 0;
 
-                // Use the available mempool space as the new node.
-                new_mem = (MemNode *)mempool->stack.base;
-                new_mem->size = ALLOC_SIZE;
-            }
+            // Not enough memory to support the size!
+            if (flMap == 0) return NULL;
+
+            fl = __FindFirstSet(flMap);
+            slMap = mempool->slBitmap[fl];
         }
+        sl = __FindFirstSet(slMap);
+
+        MemNode *const new_mem = mempool->freeLists[fl][sl];
+        __MemPoolRemoveFree(mempool, new_mem);
+        __MemPoolSplit(mempool, new_mem, ALLOC_SIZE);
 
         // Visual of the allocation block.
         // --------------
-        // | mem size   | lowest addr of block
-        // | next node  | 12 byte (32-bit) header
-        // | prev node  | 24 byte (64-bit) header
-        // --------------
+        // | prev block | lowest addr of block
+        // | block size | 8 byte (32-bit) header
+        // --------------  16 byte (64-bit) header
         // |   alloc'd  |
         // |   memory   |
         // |   space    | highest addr of block
         // --------------
-        new_mem->next = new_mem->prev = NULL;
-        uint8_t *const final_mem = (uint8_t *)new_mem + sizeof *new_mem;
-        return memset(final_mem, 0, new_mem->size - sizeof *new_mem);
+        uint8_t *const final_mem = (uint8_t *)new_mem + MEMPOOL_HEADER_SIZE;
+        return memset(final_mem, 0, __MemNodeSize(new_mem) - MEMPOOL_HEADER_SIZE);
     }
 }
 
@@ -329,18 +508,51 @@ void *MemPoolRealloc(MemPool *const restrict mempool, void *ptr, const size_t si
     if ((mempool == NULL) || (size > mempool->stack.size)) return NULL;
     // NULL ptr should make this work like regular Allocation.
     else if (ptr == NULL) return MemPoolAlloc(mempool, size);
-    else if ((uintptr_t)ptr - sizeof(MemNode) < (uintptr_t)mempool->stack.mem) return NULL;
+    else if (((uint8_t *)ptr < (mempool->stack.mem + MEMPOOL_HEADER_SIZE)) || ((uint8_t *)ptr > mempool->stack.base)) return NULL;
     else
     {
-        MemNode *const node = (MemNode *)((uint8_t *)ptr - sizeof *node);
-        const size_t NODE_SIZE = sizeof *node;
+        MemNode *const node = (MemNode *)((uint8_t *)ptr - MEMPOOL_HEADER_SIZE);
+        const size_t NODE_SIZE = __MemNodeSize(node);
+
+        size_t ALLOC_SIZE = __AlignSize(size + MEMPOOL_HEADER_SIZE, MEMPOOL_ALIGN);
+        if (ALLOC_SIZE < MEMPOOL_MIN_BLOCK) ALLOC_SIZE = MEMPOOL_MIN_BLOCK;
+
+        // Grow in place if next block is free and big enough
+        MemNode *const next = __MemNodeNext(node);
+        if ((NODE_SIZE < ALLOC_SIZE) && (next->size & MEMPOOL_BLOCK_FREE) && ((NODE_SIZE + __MemNodeSize(next)) >= ALLOC_SIZE))
+        {
+            __MemPoolRemoveFree(mempool, next);
+            node->size = NODE_SIZE + __MemNodeSize(next);
+            __MemNodeNext(node)->prevPhys = node;
+            memset((uint8_t *)node + NODE_SIZE, 0, ALLOC_SIZE - NODE_SIZE);
+        }
+
+        if (__MemNodeSize(node) >= ALLOC_SIZE)
+        {
+            // Shrink block, released memory is merged with next free block
+            if (__MemNodeSize(node) >= (ALLOC_SIZE + MEMPOOL_MIN_BLOCK))
+            {
+                MemNode *const rest = (MemNode *)((uint8_t *)node + ALLOC_SIZE);
+                rest->prevPhys = node;
+                rest->size = __MemNodeSize(node) - ALLOC_SIZE;
+                __MemNodeNext(rest)->prevPhys = rest;
+                node->size = ALLOC_SIZE;
+
+                MemPoolFree(mempool, (uint8_t *)rest + MEMPOOL_HEADER_SIZE);
+            }
+
+            // Memory after requested size is cleared, as MemPoolAlloc() does
+            memset((uint8_t *)ptr + size, 0, __MemNodeSize(node) - MEMPOOL_HEADER_SIZE - size);
+
+            return ptr;
+        }
+
         uint8_t *const resized_block = MemPoolAlloc(mempool, size);
 
         if (resized_block == NULL) return NULL;
         else
         {
-            MemNode *const resized = (MemNode *)(resized_block - sizeof *resized);
-            memmove(resized_block, ptr, (node->size > resized->size)? (resized->size - NODE_SIZE) : (node->size - NODE_SIZE));
+            memcpy(resized_block, ptr, NODE_SIZE - MEMPOOL_HEADER_SIZE);
             MemPoolFree(mempool, ptr);
             return resized_block;
         }
@@ -349,64 +561,40 @@ void *MemPoolRealloc(MemPool *const restrict mempool, void *ptr, const size_t si
 
 void MemPoolFree(MemPool *const restrict mempool, void *ptr)
 {
-    if ((mempool == NULL) || (ptr == NULL) || ((uintptr_t)ptr - sizeof(MemNode) < (uintptr_t)mempool->stack.mem)) return;
+    if ((mempool == NULL) || (ptr == NULL) || ((uint8_t *)ptr < (mempool->stack.mem + MEMPOOL_HEADER_SIZE)) || ((uint8_t *)ptr > mempool->stack.base)) return;
     else
     {
         // Behind the actual pointer data is the allocation info.
-        MemNode *const mem_node = (MemNode *)((uint8_t *)ptr - sizeof *mem_node);
-        const size_t BUCKET_INDEX = (mem_node->size >> MEMPOOL_BUCKET_BITS) - 1;
-
-        // Make sure the pointer data is valid.
-        if (((uintptr_t)mem_node < (uintptr_t)mempool->stack.base) ||
-            (((uintptr_t)mem_node - (uintptr_t)mempool->stack.mem) > mempool->stack.size) ||
-            (mem_node->size == 0UL) ||
-            (mem_node->size > mempool->stack.size)) return;
-        // If the mem_node is right at the stack base ptr, then add it to the stack.
-        else if ((uintptr_t)mem_node == (uintptr_t)mempool->stack.base)
-        {
-            mempool->stack.base += mem_node->size;
-        }
-        // attempted stack merge failed, try to place it into the memnode buckets
-        else if (BUCKET_INDEX < MEMPOOL_BUCKET_SIZE)
+        MemNode *mem_node = (MemNode *)((uint8_t *)ptr - MEMPOOL_HEADER_SIZE);
+
+        // Make sure the pointer data is valid and prevent double frees.
+        if ((mem_node->size & MEMPOOL_BLOCK_FREE) || (mem_node->size < MEMPOOL_MIN_BLOCK) ||
+            (mem_node->size > (size_t)(mempool->stack.base - (uint8_t *)mem_node))) return;
+
+        // Coalesce with free neighbour blocks, no two free blocks are ever contiguous
+        MemNode *const prev = mem_node->prevPhys;
+        if ((prev != NULL) && (prev->size & MEMPOOL_BLOCK_FREE))
         {
-            if (mempool->buckets[BUCKET_INDEX] == NULL) mempool->buckets[BUCKET_INDEX] = mem_node;
-            else
-            {
-                for (MemNode *n = mempool->buckets[BUCKET_INDEX]; n != NULL; n = n->next) if( n==mem_node ) return;
-                mempool->buckets[BUCKET_INDEX]->prev = mem_node;
-                mem_node->next = mempool->buckets[BUCKET_INDEX];
-                mempool->buckets[BUCKET_INDEX] = mem_node;
-            }
+            __MemPoolRemoveFree(mempool, prev);
+            prev->size += mem_node->size;
+
+            // NOTE: Merged block header is flagged free, so a double free of ptr is ignored
+            mem_node->size |= MEMPOOL_BLOCK_FREE;
+            mem_node = prev;
         }
-        // Otherwise, we add it to the free list.
-        // We also check if the freelist already has the pointer so we can prevent double frees.
-        else /*if ((mempool->freeList.len == 0UL) || ((uintptr_t)mempool->freeList.head >= (uintptr_t)mempool->stack.mem && (uintptr_t)mempool->freeList.head - (uintptr_t)mempool->stack.mem < mempool->stack.size))*/
-        {
-            for (MemNode *n = mempool->freeList.head; n != NULL; n = n->next) if (n == mem_node) return;
 
-            // This code insertion sorts where largest size is last.
-            if (mempool->freeList.head == NULL)
-            {
-                mempool->freeList.head = mempool->freeList.tail = mem_node;
-                mempool->freeList.len++;
-            }
-            else if (mempool->freeList.head->size >= mem_node->size)
-            {
-                mem_node->next = mempool->freeList.head;
-                mem_node->next->prev = mem_node;
-                mempool->freeList.head = mem_node;
-                mempool->freeList.len++;
-            }
-            else //if (mempool->freeList.tail->size <= mem_node->size)
-            {
-                mem_node->prev = mempool->freeList.tail;
-                mempool->freeList.tail->next = mem_node;
-                mempool->freeList.tail = mem_node;
-                mempool->freeList.len++;
-            }
+        MemNode *const next = __MemNodeNext(mem_node);
+        if (next->size & MEMPOOL_BLOCK_FREE)
+        {
+            __MemPoolRemoveFree(mempool, next);
+            mem_node->size += next->size;
 
-            if (mempool->freeList.autoDefrag && (mempool->freeList.maxNodes != 0UL) && (mempool->freeList.len > mempool->freeList.maxNodes)) MemPoolDefrag(mempool);
+            // NOTE: Merged block header is flagged free, so a double free of next block is ignored
+            next->size |= MEMPOOL_BLOCK_FREE;
         }
+
+        __MemNodeNext(mem_node)->prevPhys = mem_node;
+        __MemPoolInsertFree(mempool, mem_node);
     }
 }
 
@@ -422,149 +610,29 @@ void MemPoolCleanUp(MemPool *const restrict mempool, void **ptrref)
 
 size_t GetMemPoolFreeMemory(const MemPool mempool)
 {
-    size_t total_remaining = (uintptr_t)mempool.stack.base - (uintptr_t)mempool.stack.mem;
-
-    for (MemNode *n=mempool.freeList.head; n != NULL; n = n->next) total_remaining += n->size;
-
-    for (size_t i=0; i<MEMPOOL_BUCKET_SIZE; i++) for (MemNode *n = mempool.buckets[i]; n != NULL; n = n->next) total_remaining += n->size;
-
-    return total_remaining;
+    return mempool.freeMemory;
 }
 
 void MemPoolReset(MemPool *const mempool)
 {
-    if (mempool == NULL) return;
-    mempool->freeList.head = mempool->freeList.tail = NULL;
-    mempool->freeList.len = 0;
-    for (size_t i = 0; i < MEMPOOL_BUCKET_SIZE; i++) mempool->buckets[i] = NULL;
-    mempool->stack.base = mempool->stack.mem + mempool->stack.size;
+    if ((mempool == NULL) || (mempool->stack.mem == NULL)) return;
+    __MemPoolInit(mempool);
 }
 
+// NOTE: Free blocks are coalesced on MemPoolFree(), there is nothing left to defragment,
+// kept for compatibility, it only returns true if the pool memory has been entirely released
 bool MemPoolDefrag(MemPool *const mempool)
 {
-    if (mempool == NULL) return false;
-    else
-    {
-        // If the memory pool has been entirely released, fully defrag it.
-        if (mempool->stack.size == GetMemPoolFreeMemory(*mempool))
-        {
-            MemPoolReset(mempool);
-            return true;
-        }
-        else
-        {
-            for (size_t i=0; i<MEMPOOL_BUCKET_SIZE; i++)
-            {
-                while (mempool->buckets[i] != NULL)
-                {
-                    if ((uintptr_t)mempool->buckets[i] == (uintptr_t)mempool->stack.base)
-                    {
-                        mempool->stack.base += mempool->buckets[i]->size;
-                        mempool->buckets[i]->size = 0;
-                        mempool->buckets[i] = mempool->buckets[i]->next;
-                        if (mempool->buckets[i] != NULL) mempool->buckets[i]->prev = NULL;
-                    }
-                    else break;
-                }
-            }
-
-            const size_t PRE_DEFRAG_LEN = mempool->freeList.len;
-            MemNode **node = &mempool->freeList.head;
-
-            while (*node != NULL)
-            {
-                if ((uintptr_t)*node == (uintptr_t)mempool->stack.base)
-                {
-                    // If node is right at the stack, merge it back into the stack.
-                    mempool->stack.base += (*node)->size;
-                    (*node)->size = 0UL;
-                    ((*node)->prev != NULL)? ((*node)->prev->next = (*node)->next) : (mempool->freeList.head = (*node)->next);
-                    ((*node)->next != NULL)? ((*node)->next->prev = (*node)->prev) : (mempool->freeList.tail = (*node)->prev);
-
-                    if (mempool->freeList.head != NULL) mempool->freeList.head->prev = NULL;
-                    else mempool->freeList.tail = NULL;
-
-                    if (mempool->freeList.tail != NULL) mempool->freeList.tail->next = NULL;
-                    mempool->freeList.len--;
-                    node = &mempool->freeList.head;
-                }
-                else if (((uintptr_t)*node + (*node)->size) == (uintptr_t)(*node)->next)
-                {
-                    // Next node is at a higher address.
-                    (*node)->size += (*node)->next->size;
-                    (*node)->next->size = 0UL;
-
-                    // <-[P Curr N]-> <-[P Next N]-> <-[P NextNext N]->
-                    //
-                    //           |--------------------|
-                    // <-[P Curr N]-> <-[P Next N]-> [P NextNext N]->
-                    if ((*node)->next->next != NULL) (*node)->next->next->prev = *node;
-
-                    // <-[P Curr N]-> <-[P NextNext N]->
-                    (*node)->next = (*node)->next->next;
-
-                    mempool->freeList.len--;
-                    node = &mempool->freeList.head;
-                }
-                else if ((((uintptr_t)*node + (*node)->size) == (uintptr_t)(*node)->prev) && ((*node)->prev->prev != NULL))
-                {
-                    // Prev node is at a higher address.
-                    (*node)->size += (*node)->prev->size;
-                    (*node)->prev->size = 0UL;
-
-                    // <-[P PrevPrev N]-> <-[P Prev N]-> <-[P Curr N]->
-                    //
-                    //               |--------------------|
-                    // <-[P PrevPrev N] <-[P Prev N]-> <-[P Curr N]->
-                    (*node)->prev->prev->next = *node;
-
-                    // <-[P PrevPrev N]-> <-[P Curr N]->
-                    (*node)->prev = (*node)->prev->prev;
-
-                    mempool->freeList.len--;
-                    node = &mempool->freeList.head;
-                }
-                else if ((*node)->prev != NULL && (*node)->next != NULL && (uintptr_t)*node - (*node)->next->size == (uintptr_t)(*node)->next)
-                {
-                    // Next node is at a lower address.
-                    (*node)->next->size += (*node)->size;
-
-                    (*node)->size = 0UL;
-                    (*node)->next->prev = (*node)->prev;
-                    (*node)->prev->next = (*node)->next;
-                    *node = (*node)->next;
-
-                    mempool->freeList.len--;
-                    node = &mempool->freeList.head;
-                }
-                else if ((*node)->prev != NULL && (*node)->next != NULL && (uintptr_t)*node - (*node)->prev->size == (uintptr_t)(*node)->prev)
-                {
-                    // Prev node is at a lower address.
-                    (*node)->prev->size += (*node)->size;
-
-                    (*node)->size = 0UL;
-                    (*node)->next->prev = (*node)->prev;
-                    (*node)->prev->next = (*node)->next;
-                    *node = (*node)->prev;
-
-                    mempool->freeList.len--;
-                    node = &mempool->freeList.head;
-                }
-                else
-                {
-                    node = &(*node)->next;
-                }
-            }
+    if ((mempool == NULL) || (mempool->stack.mem == NULL)) return false;
 
-            return PRE_DEFRAG_LEN > mempool->freeList.len;
-        }
-    }
+    const MemNode *const first = (MemNode *)__AlignSize((uintptr_t)mempool->stack.mem, MEMPOOL_ALIGN);
+    return (first->size & MEMPOOL_BLOCK_FREE) && (__MemNodeNext(first) == (MemNode *)mempool->stack.base);
 }
 
+// NOTE: Kept for compatibility, free blocks are always coalesced
 void ToggleMemPoolAutoDefrag(MemPool *const mempool)
 {
-    if (mempool == NULL) return;
-    else mempool->freeList.autoDefrag ^= true;
+    (void)mempool;
 }
 
 //----------------------------------------------------------------------------------
@@ -687,6 +755,213 @@ void ObjPoolCleanUp(ObjPool *const restrict objpool, void **ptrref)
 }
 
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Shared Object Pool
+//----------------------------------------------------------------------------------
+
+static inline uint64_t __AtomicLoad64(volatile uint64_t *const value)
+{
+#if defined(_MSC_VER)
+    return (uint64_t)_InterlockedCompareExchange64((volatile long long *)value, 0, 0);
+#else
+    return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+#endif
+}
+
+// Replace value if it is still the expected one, expected is updated with current value on failure
+static inline bool __AtomicCompareExchange64(volatile uint64_t *const value, uint64_t *const expected, const uint64_t desired)
+{
+#if defined(_MSC_VER)
+    const uint64_t current = (uint64_t)_InterlockedCompareExchange64((volatile long long *)value, (long long)desired, (long long)*expected);
+    if (current == *expected) return true;
+    *expected = current;
+    return false;
+#else
+    return __atomic_compare_exchange_n(value, expected, desired, true, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+#endif
+}
+
+// Get calling thread cache index, -1 if all thread caches are taken
+// NOTE: Indexes are never recycled, threads that exit should call SharedObjPoolFlush()
+static inline int __GetThreadIndex(void)
+{
+    if (rmemThreadIndex < 0)
+    {
+#if defined(_MSC_VER)
+        rmemThreadIndex = (int)_InterlockedIncrement(&rmemThreadCount) - 1;
+#else
+        rmemThreadIndex = (int)__atomic_fetch_add(&rmemThreadCount, 1, __ATOMIC_RELAXED);
+#endif
+    }
+
+    return (rmemThreadIndex < SHARED_OBJPOOL_MAX_THREADS)? rmemThreadIndex : -1;
+}
+
+// Free objects are linked by index, stored in the object memory
+static inline uint32_t *__SharedObjNext(const SharedObjPool *const objpool, const uint32_t index)
+{
+    return (uint32_t *)(objpool->mem + index*objpool->objSize);
+}
+
+// Push a chain of linked objects (first to last) into the global free list
+static void __SharedObjPoolPush(SharedObjPool *const objpool, const uint32_t first, const uint32_t last)
+{
+    uint64_t head = __AtomicLoad64(&objpool->freeHead);
+    uint64_t newHead = 0;
+
+    do
+    {
+        *__SharedObjNext(objpool, last) = (uint32_t)head;
+        newHead = (((head >> 32) + 1) << 32) | first;
+    } while (!__AtomicCompareExchange64(&objpool->freeHead, &head, newHead));
+}
+
+// Pop an object from the global free list, SHARED_OBJPOOL_EMPTY if there are no free objects
+// NOTE: Next index could be read from an object just allocated by another thread,
+// the ABA tag makes the exchange fail in that case
+static uint32_t __SharedObjPoolPop(SharedObjPool *const objpool)
+{
+    uint64_t head = __AtomicLoad64(&objpool->freeHead);
+    uint64_t newHead = 0;
+
+    do
+    {
+        const uint32_t index = (uint32_t)head;
+        if (index == SHARED_OBJPOOL_EMPTY) return SHARED_OBJPOOL_EMPTY;
+
+        newHead = (((head >> 32) + 1) << 32) | *(volatile uint32_t *)__SharedObjNext(objpool, index);
+    } while (!__AtomicCompareExchange64(&objpool->freeHead, &head, newHead));
+
+    return (uint32_t)head;
+}
+
+// NOTE: Pool is returned as a pointer, it must not be copied, all threads use the same pool
+SharedObjPool *CreateSharedObjPool(const size_t objsize, const size_t len)
+{
+    if ((len == 0UL) || (objsize == 0UL) || (len >= SHARED_OBJPOOL_EMPTY)) return NULL;
+
+    SharedObjPool *objpool = calloc(1, sizeof(SharedObjPool));
+    if (objpool == NULL) return NULL;
+
+    objpool->objSize = __AlignSize(objsize, sizeof(size_t));
+    objpool->len = len;
+    objpool->mem = calloc(objpool->len, objpool->objSize);
+
+    if (objpool->mem == NULL)
+    {
+        free(objpool);
+        return NULL;
+    }
+
+    for (size_t i = 0; i < objpool->len; i++) *__SharedObjNext(objpool, (uint32_t)i) = (i + 1 < objpool->len)? (uint32_t)(i + 1) : SHARED_OBJPOOL_EMPTY;
+    objpool->freeHead = 0;
+
+    for (int i = 0; i < SHARED_OBJPOOL_MAX_THREADS; i++) objpool->caches[i].head = SHARED_OBJPOOL_EMPTY;
+
+    return objpool;
+}
+
+// NOTE: No other thread can be using the pool
+void DestroySharedObjPool(SharedObjPool *const objpool)
+{
+    if (objpool == NULL) return;
+
+    free(objpool->mem);
+    free(objpool);
+}
+
+void *SharedObjPoolAlloc(SharedObjPool *const objpool)
+{
+    if (objpool == NULL) return NULL;
+
+    uint32_t index = SHARED_OBJPOOL_EMPTY;
+    const int thread = __GetThreadIndex();
+
+    if (thread >= 0)
+    {
+        ObjPoolCache *const cache = &objpool->caches[thread];
+
+        // Refill empty cache from global free list
+        if (cache->count == 0)
+        {
+            for (int i = 0; i < SHARED_OBJPOOL_CACHE_SIZE/2; i++)
+            {
+                const uint32_t refill = __SharedObjPoolPop(objpool);
+                if (refill == SHARED_OBJPOOL_EMPTY) break;
+
+                *__SharedObjNext(objpool, refill) = cache->head;
+                cache->head = refill;
+                cache->count++;
+            }
+        }
+
+        if (cache->count > 0)
+        {
+            index = cache->head;
+            cache->head = *__SharedObjNext(objpool, index);
+            cache->count--;
+        }
+    }
+    else index = __SharedObjPoolPop(objpool);
+
+    if (index == SHARED_OBJPOOL_EMPTY) return NULL;
+
+    uint8_t *const ptr = objpool->mem + index*objpool->objSize;
+    return memset(ptr, 0, objpool->objSize);
+}
+
+void SharedObjPoolFree(SharedObjPool *const restrict objpool, void *ptr)
+{
+    if ((objpool == NULL) || (ptr == NULL) || ((uint8_t *)ptr < objpool->mem)) return;
+
+    const size_t offset = (size_t)((uint8_t *)ptr - objpool->mem);
+    if ((offset >= objpool->len*objpool->objSize) || ((offset%objpool->objSize) != 0)) return;
+
+    const uint32_t index = (uint32_t)(offset/objpool->objSize);
+    const int thread = __GetThreadIndex();
+
+    if (thread >= 0)
+    {
+        ObjPoolCache *const cache = &objpool->caches[thread];
+
+        // Spill half of full cache to global free list
+        if (cache->count == SHARED_OBJPOOL_CACHE_SIZE)
+        {
+            const uint32_t first = cache->head;
+            uint32_t last = first;
+            for (int i = 1; i < SHARED_OBJPOOL_CACHE_SIZE/2; i++) last = *__SharedObjNext(objpool, last);
+
+            cache->head = *__SharedObjNext(objpool, last);
+            cache->count -= SHARED_OBJPOOL_CACHE_SIZE/2;
+            __SharedObjPoolPush(objpool, first, last);
+        }
+
+        *__SharedObjNext(objpool, index) = cache->head;
+        cache->head = index;
+        cache->count++;
+    }
+    else __SharedObjPoolPush(objpool, index, index);
+}
+
+// Return calling thread cached objects to global free list
+// NOTE: Call it before a thread that used the pool exits, so other threads can reuse its objects
+void SharedObjPoolFlush(SharedObjPool *const objpool)
+{
+    const int thread = __GetThreadIndex();
+    if ((objpool == NULL) || (thread < 0)) return;
+
+    ObjPoolCache *const cache = &objpool->caches[thread];
+    if (cache->count == 0) return;
+
+    uint32_t last = cache->head;
+    for (uint32_t i = 1; i < cache->count; i++) last = *__SharedObjNext(objpool, last);
+
+    __SharedObjPoolPush(objpool, cache->head, last);
+    cache->head = SHARED_OBJPOOL_EMPTY;
+    cache->count = 0;
+}
+
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Double-Ended Stack
 //----------------------------------------------------------------------------------
@@ -771,4 +1046,84 @@ intptr_t BiStackMargins(const BiStack destack)
     return destack.back - destack.front;
 }
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Frame Arena
+//----------------------------------------------------------------------------------
+
+// Every allocation is preceded by a header holding its aligned size,
+// header and allocation sizes are multiple of 16 so pointers keep malloc() alignment
+#define FRAME_ARENA_ALIGN    16
+
+FrameArena CreateFrameArena(const size_t bytes)
+{
+    FrameArena arena = { 0 };
+    arena.stack = CreateBiStack(__AlignSize(bytes, FRAME_ARENA_ALIGN));
+    return arena;
+}
+
+FrameArena CreateFrameArenaFromBuffer(void *const buf, const size_t bytes)
+{
+    FrameArena arena = { 0 };
+
+    // Buffer must keep allocations alignment
+    if ((buf == NULL) || (((uintptr_t)buf & (FRAME_ARENA_ALIGN - 1)) != 0)) return arena;
+
+    arena.stack = CreateBiStackFromBuffer(buf, bytes & -FRAME_ARENA_ALIGN);
+    return arena;
+}
+
+void DestroyFrameArena(FrameArena *const arena)
+{
+    if (arena == NULL) return;
+    DestroyBiStack(&arena->stack);
+    *arena = (FrameArena){ 0 };
+}
+
+void *FrameArenaAlloc(FrameArena *const arena, const size_t bytes)
+{
+    if ((arena == NULL) || (bytes == 0UL)) return NULL;
+
+    const size_t ALLOC_SIZE = __AlignSize(bytes, FRAME_ARENA_ALIGN);
+
+    // Not enough memory left in arena, caller should fallback to another allocator
+    if ((size_t)BiStackMargins(arena->stack) <= (FRAME_ARENA_ALIGN + ALLOC_SIZE)) return NULL;
+
+    uint8_t *const header = BiStackAllocFront(&arena->stack, FRAME_ARENA_ALIGN + ALLOC_SIZE);
+    if (header == NULL) return NULL;
+
+    *(size_t *)header = ALLOC_SIZE;
+
+    const size_t USED = (size_t)(arena->stack.front - arena->stack.mem);
+    if (USED > arena->peak) arena->peak = USED;
+
+    return header + FRAME_ARENA_ALIGN;
+}
+
+bool FrameArenaFree(FrameArena *const arena, void *const ptr)
+{
+    if ((arena == NULL) || !FrameArenaOwns(*arena, ptr)) return false;
+
+    // Last allocation memory is reclaimed, other allocations are released on reset
+    uint8_t *const header = (uint8_t *)ptr - FRAME_ARENA_ALIGN;
+    if (((uint8_t *)ptr + *(size_t *)header) == arena->stack.front) arena->stack.front = header;
+
+    return true;
+}
+
+bool FrameArenaOwns(const FrameArena arena, const void *const ptr)
+{
+    return (arena.stack.mem != NULL) && ((const uint8_t *)ptr >= arena.stack.mem) && ((const uint8_t *)ptr < arena.stack.mem + arena.stack.size);
+}
+
+void FrameArenaReset(FrameArena *const arena)
+{
+    if (arena == NULL) return;
+    BiStackResetFront(&arena->stack);
+}
+
+size_t GetFrameArenaUsedMemory(const FrameArena arena)
+{
+    return (size_t)(arena.stack.front - arena.stack.mem);
+}
+
 #endif  // RMEM_IMPLEMENTATION
@@ -0,0 +1,344 @@
+/**********************************************************************************************
+*
+*   rtilemap - Tile-map renderer with chunked static vertex buffers
+*
+*   A grid of colored cells stored in fixed-size chunks, every chunk is a mesh uploaded once
+*   to GPU (VBO). Changing a cell only marks the modified vertex range of its chunk as dirty
+*   and just that range is re-uploaded on next draw, so steady-state drawing is one draw call
+*   per visible chunk, no matter how many cells are filled. Chunks out of the screen (with current
+*   modelview, i.e. inside BeginMode2D()) are not drawn and their dirty ranges are kept for later.
+*
+*   CONFIGURATION:
+*
+*   #define RTILEMAP_IMPLEMENTATION
+*       Generates the implementation of the library into the included file.
+*       If not defined, the library is in header only mode and can be included in other headers
+*       or source files without problems. But only ONE file should hold the implementation.
+*
+*   DEPENDENCIES:
+*       raylib  - Mesh, Material and Color types, LoadMaterialDefault(), UnloadMesh()
+*       rlgl    - GPU buffers management and drawing: rlLoadMesh(), rlUpdateMeshAt(), rlDrawMesh()
+*
+*   LICENSE: zlib/libpng
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef RTILEMAP_H
+#define RTILEMAP_H
+
+#include "raylib.h"
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#if defined(_WIN32) && defined(BUILD_LIBTYPE_SHARED)
+    #define RTILEMAPAPI __declspec(dllexport)     // We are building library as a Win32 shared library (.dll)
+#elif defined(_WIN32) && defined(USE_LIBTYPE_SHARED)
+    #define RTILEMAPAPI __declspec(dllimport)     // We are using library as a Win32 shared library (.dll)
+#else
+    #define RTILEMAPAPI   // We are building or using library as a static library (or Linux shared library)
+#endif
+
+// Chunk size in cells (chunks are square)
+// NOTE: Every cell uses 4 vertex, indices are 16bit so a chunk can't exceed 16384 cells
+#if !defined(TILEMAP_CHUNK_SIZE)
+    #define TILEMAP_CHUNK_SIZE      64
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Tile-map chunk, a mesh with one quad by cell
+typedef struct TileMapChunk {
+    Mesh mesh;                  // Chunk mesh (vertex colors updated on cells change)
+    int cellsX;                 // Chunk width in cells
+    int cellsY;                 // Chunk height in cells
+    int dirtyFirst;             // First dirty vertex to upload (-1 if chunk is clean)
+    int dirtyLast;              // Last dirty vertex to upload
+} TileMapChunk;
+
+// Tile-map, grid of colored cells
+typedef struct TileMap {
+    int width;                  // Map width in cells
+    int height;                 // Map height in cells
+    int cellSize;               // Cell size in pixels
+    int chunksX;                // Number of chunks horizontally
+    int chunksY;                // Number of chunks vertically
+    Color *cells;               // Cells color (width*height), BLANK for empty cells
+    TileMapChunk *chunks;       // Chunks data (chunksX*chunksY)
+    Material material;          // Material used to draw chunks (default material)
+} TileMap;
+
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//------------------------------------------------------------------------------------
+// Functions Declaration - Tile-map
+//------------------------------------------------------------------------------------
+RTILEMAPAPI TileMap LoadTileMap(int width, int height, int cellSize);     // Load tile-map with all cells empty (GPU buffers created)
+RTILEMAPAPI void UnloadTileMap(TileMap map);                              // Unload tile-map from CPU and GPU memory
+RTILEMAPAPI void SetTileMapCell(TileMap *map, int x, int y, Color color); // Set one cell color (marks chunk range as dirty if changed)
+RTILEMAPAPI Color GetTileMapCell(TileMap map, int x, int y);              // Get one cell color
+RTILEMAPAPI void ClearTileMap(TileMap *map, Color color);                 // Set all cells color
+RTILEMAPAPI void UpdateTileMap(TileMap *map);                             // Upload chunks dirty ranges to GPU
+RTILEMAPAPI void DrawTileMap(TileMap *map, Vector2 position);             // Draw tile-map visible chunks (uploads their dirty ranges first)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RTILEMAP_H
+
+/***********************************************************************************
+*
+*   RTILEMAP IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(RTILEMAP_IMPLEMENTATION)
+
+#include "rlgl.h"                   // Required for: rlLoadMesh(), rlUpdateMeshAt(), rlDrawMesh(), rlglDraw(), GetMatrixModelview()
+#include "raymath.h"                // Required for: MatrixTranslate(), MatrixInvert(), Vector3Transform()
+
+#include <stdlib.h>                 // Required for: calloc(), free() [Used in RL_CALLOC(), RL_FREE()]
+#include <string.h>                 // Required for: memcmp()
+
+#define TILEMAP_MESH_VBO        7   // Number of vbo per mesh (same as models module)
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Declaration
+//----------------------------------------------------------------------------------
+static TileMapChunk LoadTileMapChunk(int cellsX, int cellsY, int cellSize);  // Load chunk mesh (CPU and GPU)
+static void UpdateTileMapChunk(TileMapChunk *chunk);                        // Upload chunk dirty range to GPU
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Load tile-map with all cells empty (GPU buffers created)
+TileMap LoadTileMap(int width, int height, int cellSize)
+{
+    TileMap map = { 0 };
+
+    if ((width <= 0) || (height <= 0)) return map;
+
+    map.width = width;
+    map.height = height;
+    map.cellSize = cellSize;
+    map.chunksX = (width + TILEMAP_CHUNK_SIZE - 1)/TILEMAP_CHUNK_SIZE;
+    map.chunksY = (height + TILEMAP_CHUNK_SIZE - 1)/TILEMAP_CHUNK_SIZE;
+    map.cells = (Color *)RL_CALLOC(width*height, sizeof(Color));
+    map.chunks = (TileMapChunk *)RL_CALLOC(map.chunksX*map.chunksY, sizeof(TileMapChunk));
+
+    for (int cy = 0; cy < map.chunksY; cy++)
+    {
+        for (int cx = 0; cx < map.chunksX; cx++)
+        {
+            int cellsX = ((cx + 1)*TILEMAP_CHUNK_SIZE <= width)? TILEMAP_CHUNK_SIZE : width - cx*TILEMAP_CHUNK_SIZE;
+            int cellsY = ((cy + 1)*TILEMAP_CHUNK_SIZE <= height)? TILEMAP_CHUNK_SIZE : height - cy*TILEMAP_CHUNK_SIZE;
+
+            map.chunks[cy*map.chunksX + cx] = LoadTileMapChunk(cellsX, cellsY, cellSize);
+        }
+    }
+
+    map.material = LoadMaterialDefault();
+
+    TraceLog(LOG_INFO, "TILEMAP: Loaded %i x %i cells (%i chunks)", width, height, map.chunksX*map.chunksY);
+
+    return map;
+}
+
+// Unload tile-map from CPU and GPU memory
+void UnloadTileMap(TileMap map)
+{
+    for (int i = 0; i < map.chunksX*map.chunksY; i++) UnloadMesh(map.chunks[i].mesh);
+
+    // NOTE: Default material shader and texture are not unloaded
+    UnloadMaterial(map.material);
+    RL_FREE(map.chunks);
+    RL_FREE(map.cells);
+}
+
+// Set one cell color (marks chunk range as dirty if changed)
+void SetTileMapCell(TileMap *map, int x, int y, Color color)
+{
+    if ((x < 0) || (x >= map->width) || (y < 0) || (y >= map->height)) return;
+
+    Color *cell = &map->cells[y*map->width + x];
+
+    if (memcmp(cell, &color, sizeof(Color)) == 0) return;
+
+    *cell = color;
+
+    TileMapChunk *chunk = &map->chunks[(y/TILEMAP_CHUNK_SIZE)*map->chunksX + (x/TILEMAP_CHUNK_SIZE)];
+    int vertex = 4*((y%TILEMAP_CHUNK_SIZE)*chunk->cellsX + (x%TILEMAP_CHUNK_SIZE));
+
+    for (int i = 0; i < 4; i++)
+    {
+        chunk->mesh.colors[4*(vertex + i)] = color.r;
+        chunk->mesh.colors[4*(vertex + i) + 1] = color.g;
+        chunk->mesh.colors[4*(vertex + i) + 2] = color.b;
+        chunk->mesh.colors[4*(vertex + i) + 3] = color.a;
+    }
+
+    if ((chunk->dirtyFirst < 0) || (vertex < chunk->dirtyFirst)) chunk->dirtyFirst = vertex;
+    if (vertex + 3 > chunk->dirtyLast) chunk->dirtyLast = vertex + 3;
+}
+
+// Get one cell color
+Color GetTileMapCell(TileMap map, int x, int y)
+{
+    Color color = BLANK;
+
+    if ((x >= 0) && (x < map.width) && (y >= 0) && (y < map.height)) color = map.cells[y*map.width + x];
+
+    return color;
+}
+
+// Set all cells color
+void ClearTileMap(TileMap *map, Color color)
+{
+    for (int y = 0; y < map->height; y++)
+    {
+        for (int x = 0; x < map->width; x++) SetTileMapCell(map, x, y, color);
+    }
+}
+
+// Upload chunks dirty ranges to GPU
+// NOTE: Only one contiguous vertex range is uploaded by chunk, from first to last modified cell
+void UpdateTileMap(TileMap *map)
+{
+    for (int i = 0; i < map->chunksX*map->chunksY; i++) UpdateTileMapChunk(&map->chunks[i]);
+}
+
+// Draw tile-map visible chunks (uploads their dirty ranges first)
+// NOTE: Chunks are culled against the screen area transformed to map space by the inverse modelview,
+// culled chunks keep their dirty range until they are drawn
+void DrawTileMap(TileMap *map, Vector2 position)
+{
+    rlglDraw();     // Draw previous batched shapes, keep drawing order
+
+    Matrix invModelview = MatrixInvert(GetMatrixModelview());
+    Vector3 corners[4] = {
+        { 0.0f, 0.0f, 0.0f },
+        { (float)GetScreenWidth(), 0.0f, 0.0f },
+        { 0.0f, (float)GetScreenHeight(), 0.0f },
+        { (float)GetScreenWidth(), (float)GetScreenHeight(), 0.0f }
+    };
+
+    Vector2 viewMin = { 0 };
+    Vector2 viewMax = { 0 };
+
+    for (int i = 0; i < 4; i++)
+    {
+        Vector3 corner = Vector3Transform(corners[i], invModelview);
+
+        if ((i == 0) || (corner.x < viewMin.x)) viewMin.x = corner.x;
+        if ((i == 0) || (corner.y < viewMin.y)) viewMin.y = corner.y;
+        if ((i == 0) || (corner.x > viewMax.x)) viewMax.x = corner.x;
+        if ((i == 0) || (corner.y > viewMax.y)) viewMax.y = corner.y;
+    }
+
+    float chunkSize = (float)(TILEMAP_CHUNK_SIZE*map->cellSize);
+
+    for (int cy = 0; cy < map->chunksY; cy++)
+    {
+        for (int cx = 0; cx < map->chunksX; cx++)
+        {
+            TileMapChunk *chunk = &map->chunks[cy*map->chunksX + cx];
+            float chunkX = position.x + cx*chunkSize;
+            float chunkY = position.y + cy*chunkSize;
+
+            if ((chunkX > viewMax.x) || (chunkY > viewMax.y) ||
+                (chunkX + chunk->cellsX*map->cellSize < viewMin.x) || (chunkY + chunk->cellsY*map->cellSize < viewMin.y)) continue;
+
+            UpdateTileMapChunk(chunk);
+
+            rlDrawMesh(chunk->mesh, map->material, MatrixTranslate(chunkX, chunkY, 0.0f));
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+
+// Load chunk mesh (CPU and GPU)
+// NOTE: Vertex positions and indices are static, only colors are dynamic
+static TileMapChunk LoadTileMapChunk(int cellsX, int cellsY, int cellSize)
+{
+    TileMapChunk chunk = { 0 };
+
+    chunk.cellsX = cellsX;
+    chunk.cellsY = cellsY;
+    chunk.dirtyFirst = -1;
+    chunk.dirtyLast = -1;
+
+    int cellsCount = cellsX*cellsY;
+
+    chunk.mesh.vertexCount = 4*cellsCount;
+    chunk.mesh.triangleCount = 2*cellsCount;
+    chunk.mesh.vertices = (float *)RL_MALLOC(chunk.mesh.vertexCount*3*sizeof(float));
+    chunk.mesh.texcoords = (float *)RL_CALLOC(chunk.mesh.vertexCount*2, sizeof(float));
+    chunk.mesh.colors = (unsigned char *)RL_CALLOC(chunk.mesh.vertexCount*4, sizeof(unsigned char));
+    chunk.mesh.indices = (unsigned short *)RL_MALLOC(chunk.mesh.triangleCount*3*sizeof(unsigned short));
+    chunk.mesh.vboId = (unsigned int *)RL_CALLOC(TILEMAP_MESH_VBO, sizeof(unsigned int));
+
+    for (int y = 0; y < cellsY; y++)
+    {
+        for (int x = 0; x < cellsX; x++)
+        {
+            int cell = y*cellsX + x;
+            float *vertex = &chunk.mesh.vertices[3*4*cell];
+            unsigned short *index = &chunk.mesh.indices[6*cell];
+
+            // NOTE: Same vertex order than shapes quads (counter-clockwise on screen space)
+            vertex[0] = (float)(x*cellSize); vertex[1] = (float)(y*cellSize); vertex[2] = 0.0f;
+            vertex[3] = (float)(x*cellSize); vertex[4] = (float)((y + 1)*cellSize); vertex[5] = 0.0f;
+            vertex[6] = (float)((x + 1)*cellSize); vertex[7] = (float)((y + 1)*cellSize); vertex[8] = 0.0f;
+            vertex[9] = (float)((x + 1)*cellSize); vertex[10] = (float)(y*cellSize); vertex[11] = 0.0f;
+
+            index[0] = 4*cell; index[1] = 4*cell + 1; index[2] = 4*cell + 2;
+            index[3] = 4*cell; index[4] = 4*cell + 2; index[5] = 4*cell + 3;
+        }
+    }
+
+    rlLoadMesh(&chunk.mesh, true);      // Dynamic mesh, colors are updated
+
+    return chunk;
+}
+
+// Upload chunk dirty range to GPU
+// NOTE: Only one contiguous vertex range is uploaded, from first to last modified cell
+static void UpdateTileMapChunk(TileMapChunk *chunk)
+{
+    if (chunk->dirtyFirst < 0) return;
+
+    // NOTE: rlUpdateMeshAt() reads provided data from the start of mesh arrays
+    Mesh range = chunk->mesh;
+    range.colors += 4*chunk->dirtyFirst;
+
+    rlUpdateMeshAt(range, 3, chunk->dirtyLast - chunk->dirtyFirst + 1, chunk->dirtyFirst);
+
+    chunk->dirtyFirst = -1;
+    chunk->dirtyLast = -1;
+}
+
+#endif  // RTILEMAP_IMPLEMENTATION
@@ -0,0 +1,392 @@
+/**********************************************************************************************
+*
+*   rtrace - Scoped trace zones saved as Chrome trace events (chrome://tracing, Perfetto)
+*
+*   Every thread records zone begin/end events (name and timestamp) into its own ring buffer,
+*   no locks are taken while recording, a zone costs two timer reads and two stores.
+*   On x86 the timer is the CPU timestamp counter (rdtsc), calibrated against the system
+*   monotonic clock when saving, other platforms read the monotonic clock directly.
+*   Buffers are written as a Chrome trace JSON file on request, usually on program exit.
+*
+*   CONFIGURATION:
+*
+*   #define RTRACE_IMPLEMENTATION
+*       Generates the implementation of the library into the included file.
+*       If not defined, the library is in header only mode and can be included in other headers
+*       or source files without problems. But only ONE file should hold the implementation.
+*
+*   #define SUPPORT_TRACING
+*       Enables TRACE_ZONE_BEGIN()/TRACE_ZONE_END()/TRACE_THREAD_NAME() macros,
+*       if not defined macros expand to nothing, so instrumented code has no cost.
+*
+*   #define RTRACE_BUFFER_EVENTS
+*       Number of events kept by thread (power of two), oldest events are overwritten
+*
+*   LIMITATIONS:
+*       - Zone names must be static strings (only pointer is stored) with no characters to escape
+*       - Zone begin/end must be balanced in the same thread, as in a function scope
+*
+*   LICENSE: zlib/libpng
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef RTRACE_H
+#define RTRACE_H
+
+#include <stdbool.h>
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#if defined(_WIN32) && defined(BUILD_LIBTYPE_SHARED)
+    #define RTRACEAPI __declspec(dllexport)       // We are building library as a Win32 shared library (.dll)
+#elif defined(_WIN32) && defined(USE_LIBTYPE_SHARED)
+    #define RTRACEAPI __declspec(dllimport)       // We are using library as a Win32 shared library (.dll)
+#else
+    #define RTRACEAPI   // We are building or using library as a static library (or Linux shared library)
+#endif
+
+// Trace zones instrumentation, compiled out if tracing not supported
+#if defined(SUPPORT_TRACING)
+    #define TRACE_ZONE_BEGIN(name)      BeginTraceZone(name)
+    #define TRACE_ZONE_END()            EndTraceZone()
+    #define TRACE_THREAD_NAME(name)     SetTraceThreadName(name)
+#else
+    #define TRACE_ZONE_BEGIN(name)      ((void)0)
+    #define TRACE_ZONE_END()            ((void)0)
+    #define TRACE_THREAD_NAME(name)     ((void)0)
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+RTRACEAPI void BeginTraceZone(const char *name);              // Begin trace zone in current thread (name must be a static string)
+RTRACEAPI void EndTraceZone(void);                            // End last trace zone begun in current thread
+RTRACEAPI void SetTraceThreadName(const char *name);          // Set current thread name shown in trace viewer
+RTRACEAPI bool SaveTraceFile(const char *fileName);           // Save recorded trace events as Chrome trace JSON file
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RTRACE_H
+
+/***********************************************************************************
+*
+*   RTRACE IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(RTRACE_IMPLEMENTATION)
+
+#include <stdlib.h>                 // Required for: calloc(), free()
+#include <stdio.h>                  // Required for: FILE, fopen(), fprintf(), fclose()
+#include <string.h>                 // Required for: strncpy()
+
+#if !defined(_WIN32)
+    #include <time.h>               // Required for: clock_gettime()
+#endif
+
+#if !defined(RL_CALLOC)
+    #define RL_CALLOC(n,sz)     calloc(n,sz)
+    #define RL_FREE(p)          free(p)
+#endif
+
+#if !defined(RTRACE_BUFFER_EVENTS)
+    #define RTRACE_BUFFER_EVENTS    65536       // Events kept by thread (power of two), 1 MB by thread
+#endif
+
+#define RTRACE_MAX_THREADS          16          // Max number of threads recording events
+
+#if defined(_MSC_VER)
+    #include <intrin.h>             // Required for: _InterlockedIncrement(), __rdtsc()
+
+    #define RTRACE_THREAD_LOCAL         __declspec(thread)
+    #define RTRACE_ATOMIC_INC(x)        (_InterlockedIncrement((volatile long *)&(x)) - 1)
+    #define RTRACE_STORE_RELEASE(x, v)  ((x) = (v))     // NOTE: x86/x64 stores are not reordered with other stores
+    #define RTRACE_LOAD_ACQUIRE(x)      (x)
+#else
+    #define RTRACE_THREAD_LOCAL         __thread
+    #define RTRACE_ATOMIC_INC(x)        __atomic_fetch_add(&(x), 1, __ATOMIC_RELAXED)
+    #define RTRACE_STORE_RELEASE(x, v)  __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+    #define RTRACE_LOAD_ACQUIRE(x)      __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#endif
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #define RTRACE_TIMER_TSC
+    #if !defined(_MSC_VER)
+        #include <x86intrin.h>      // Required for: __rdtsc()
+    #endif
+#endif
+
+#if defined(_WIN32)
+    // NOTE: Declared here to avoid including windows.h (conflicts with raylib symbols)
+    __declspec(dllimport) int __stdcall QueryPerformanceCounter(long long *lpPerformanceCount);
+    __declspec(dllimport) int __stdcall QueryPerformanceFrequency(long long *lpFrequency);
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Trace event, zone begin or end
+typedef struct TraceEvent {
+    unsigned long long time;        // Event timestamp (timer ticks)
+    const char *name;               // Zone name (NULL for zone end)
+} TraceEvent;
+
+// Thread events ring buffer
+typedef struct TraceBuffer {
+    TraceEvent *events;             // Events ring (RTRACE_BUFFER_EVENTS)
+    unsigned long long count;       // Total events recorded (next event index in ring)
+    char threadName[32];            // Thread name (shown in trace viewer)
+} TraceBuffer;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static TraceBuffer traceBuffers[RTRACE_MAX_THREADS] = { 0 };   // Threads ring buffers
+static int traceBuffersCount = 0;                               // Number of threads registered (may exceed max)
+static RTRACE_THREAD_LOCAL TraceBuffer *traceBuffer = NULL;     // Current thread ring buffer
+static RTRACE_THREAD_LOCAL bool traceBufferFull = false;        // Current thread could not be registered
+#if defined(RTRACE_TIMER_TSC)
+static unsigned long long traceBaseTicks = 0;                   // Timer ticks on first thread registered (calibration)
+static double traceBaseClock = 0.0;                             // Monotonic clock on first thread registered (calibration)
+#endif
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Declaration
+//----------------------------------------------------------------------------------
+static inline unsigned long long GetTraceTime(void);            // Get timestamp (timer ticks)
+static double GetTraceClock(void);                              // Get monotonic clock time (seconds)
+static TraceBuffer *LoadTraceBuffer(void);                      // Register current thread buffer
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Begin trace zone in current thread
+void BeginTraceZone(const char *name)
+{
+    TraceBuffer *buffer = (traceBuffer != NULL)? traceBuffer : LoadTraceBuffer();
+
+    if (buffer != NULL)
+    {
+        TraceEvent *event = &buffer->events[buffer->count & (RTRACE_BUFFER_EVENTS - 1)];
+
+        event->time = GetTraceTime();
+        event->name = name;
+
+        // NOTE: Count is published after event data, SaveTraceFile() can run on another thread
+        RTRACE_STORE_RELEASE(buffer->count, buffer->count + 1);
+    }
+}
+
+// End last trace zone begun in current thread
+void EndTraceZone(void)
+{
+    TraceBuffer *buffer = traceBuffer;
+
+    if (buffer != NULL)
+    {
+        TraceEvent *event = &buffer->events[buffer->count & (RTRACE_BUFFER_EVENTS - 1)];
+
+        event->time = GetTraceTime();
+        event->name = NULL;
+
+        RTRACE_STORE_RELEASE(buffer->count, buffer->count + 1);
+    }
+}
+
+// Set current thread name shown in trace viewer
+void SetTraceThreadName(const char *name)
+{
+    TraceBuffer *buffer = (traceBuffer != NULL)? traceBuffer : LoadTraceBuffer();
+
+    if (buffer != NULL) strncpy(buffer->threadName, name, sizeof(buffer->threadName) - 1);
+}
+
+// Save recorded trace events as Chrome trace JSON file
+// NOTE: Timestamps are written in microseconds relative to the first event recorded,
+// events overwritten in the rings are lost, zone ends without their begin are skipped
+bool SaveTraceFile(const char *fileName)
+{
+    FILE *file = fopen(fileName, "wt");
+
+    if (file == NULL) return false;
+
+    // Get timer frequency (ticks per second)
+#if defined(RTRACE_TIMER_TSC)
+    double clockElapsed = GetTraceClock() - traceBaseClock;
+    double frequency = (clockElapsed > 0.0)? (double)(GetTraceTime() - traceBaseTicks)/clockElapsed : 1000000000.0;
+#elif defined(_WIN32)
+    long long ticksPerSecond = 0;
+    QueryPerformanceFrequency(&ticksPerSecond);
+    double frequency = (double)ticksPerSecond;
+#else
+    double frequency = 1000000000.0;
+#endif
+
+    int buffersCount = RTRACE_LOAD_ACQUIRE(traceBuffersCount);
+    if (buffersCount > RTRACE_MAX_THREADS) buffersCount = RTRACE_MAX_THREADS;
+
+    unsigned long long counts[RTRACE_MAX_THREADS] = { 0 };
+    unsigned long long baseTime = 0;
+    bool baseTimeSet = false;
+
+    // Get events recorded by every thread and the first timestamp
+    for (int i = 0; i < buffersCount; i++)
+    {
+        TraceBuffer *buffer = &traceBuffers[i];
+
+        if (buffer->events == NULL) continue;
+
+        counts[i] = RTRACE_LOAD_ACQUIRE(buffer->count);
+        unsigned long long first = (counts[i] > RTRACE_BUFFER_EVENTS)? counts[i] - RTRACE_BUFFER_EVENTS : 0;
+
+        if ((counts[i] > first) && (!baseTimeSet || (buffer->events[first & (RTRACE_BUFFER_EVENTS - 1)].time < baseTime)))
+        {
+            baseTime = buffer->events[first & (RTRACE_BUFFER_EVENTS - 1)].time;
+            baseTimeSet = true;
+        }
+    }
+
+    fprintf(file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+
+    bool firstEvent = true;
+
+    for (int i = 0; i < buffersCount; i++)
+    {
+        TraceBuffer *buffer = &traceBuffers[i];
+
+        if (buffer->events == NULL) continue;
+
+        fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%i,\"args\":{\"name\":\"%s\"}}",
+                firstEvent? "" : ",\n", i + 1, (buffer->threadName[0] != '\0')? buffer->threadName : "thread");
+        firstEvent = false;
+
+        unsigned long long first = (counts[i] > RTRACE_BUFFER_EVENTS)? counts[i] - RTRACE_BUFFER_EVENTS : 0;
+        int depth = 0;
+
+        for (unsigned long long e = first; e < counts[i]; e++)
+        {
+            const TraceEvent *event = &buffer->events[e & (RTRACE_BUFFER_EVENTS - 1)];
+            double time = (double)(event->time - baseTime)*1000000.0/frequency;
+
+            if (event->name != NULL)
+            {
+                fprintf(file, ",\n{\"name\":\"%s\",\"ph\":\"B\",\"pid\":1,\"tid\":%i,\"ts\":%.3f}", event->name, i + 1, time);
+                depth++;
+            }
+            else if (depth > 0)
+            {
+                fprintf(file, ",\n{\"ph\":\"E\",\"pid\":1,\"tid\":%i,\"ts\":%.3f}", i + 1, time);
+                depth--;
+            }
+        }
+    }
+
+    fprintf(file, "\n]}\n");
+    fclose(file);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+
+// Get timestamp (timer ticks)
+// NOTE: Ticks are CPU timestamp counter on x86, nanoseconds on other POSIX systems, performance counter on Windows
+static inline unsigned long long GetTraceTime(void)
+{
+#if defined(RTRACE_TIMER_TSC)
+    return (unsigned long long)__rdtsc();
+#elif defined(_WIN32)
+    long long ticks = 0;
+    QueryPerformanceCounter(&ticks);
+
+    return (unsigned long long)ticks;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (unsigned long long)ts.tv_sec*1000000000ULL + (unsigned long long)ts.tv_nsec;
+#endif
+}
+
+// Get monotonic clock time (seconds)
+static double GetTraceClock(void)
+{
+#if defined(_WIN32)
+    long long ticks = 0;
+    long long ticksPerSecond = 0;
+    QueryPerformanceCounter(&ticks);
+    QueryPerformanceFrequency(&ticksPerSecond);
+
+    return (double)ticks/(double)ticksPerSecond;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec*1e-9;
+#endif
+}
+
+// Register current thread buffer
+// NOTE: Buffers are never released, threads finished keep their events until saved
+static TraceBuffer *LoadTraceBuffer(void)
+{
+    if (traceBufferFull) return NULL;
+
+    int index = RTRACE_ATOMIC_INC(traceBuffersCount);
+
+    if (index >= RTRACE_MAX_THREADS)
+    {
+        traceBufferFull = true;
+        return NULL;
+    }
+
+    traceBuffers[index].events = (TraceEvent *)RL_CALLOC(RTRACE_BUFFER_EVENTS, sizeof(TraceEvent));
+
+    if (traceBuffers[index].events == NULL)
+    {
+        traceBufferFull = true;
+        return NULL;
+    }
+
+#if defined(RTRACE_TIMER_TSC)
+    // NOTE: Timer calibration starts with first thread registered
+    if (index == 0)
+    {
+        traceBaseClock = GetTraceClock();
+        traceBaseTicks = GetTraceTime();
+    }
+#endif
+
+    traceBuffer = &traceBuffers[index];
+
+    return traceBuffer;
+}
+
+#endif  // RTRACE_IMPLEMENTATION
@@ -42,6 +42,8 @@
 
 #include "rlgl.h"       // raylib OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2
 
+#include "utils.h"      // Required for: RL_MALLOC() tracking [Only if SUPPORT_MEMORY_TRACKING]
+
 #include <stdlib.h>     // Required for: abs(), fabs()
 #include <math.h>       // Required for: sinf(), cosf(), sqrtf()
 
@@ -66,6 +68,7 @@ static Rectangle recTexShapes = { 0 };      // Texture source rectangle used on
 //----------------------------------------------------------------------------------
 static float EaseCubicInOut(float t, float b, float c, float d);    // Cubic easing
 static Texture2D GetShapesTexture(void);                            // Get texture to draw shapes
+static void DrawShapesQuad(const float *vertices, const unsigned char *colors);  // Draw one quad with shapes texture
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -599,34 +602,38 @@ void DrawRectangleRec(Rectangle rec, Color color)
 }
 
 // Draw a color-filled rectangle with pro parameters
+// NOTE: Corners are transformed on CPU (no matrix push/pop) and the quad is sent as one vertex block
 void DrawRectanglePro(Rectangle rec, Vector2 origin, float rotation, Color color)
 {
-    rlEnableTexture(GetShapesTexture().id);
-
-    rlPushMatrix();
-        rlTranslatef(rec.x, rec.y, 0.0f);
-        rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
-        rlTranslatef(-origin.x, -origin.y, 0.0f);
-
-        rlBegin(RL_QUADS);
-            rlNormal3f(0.0f, 0.0f, 1.0f);
-            rlColor4ub(color.r, color.g, color.b, color.a);
+    // Corners relative to origin: top-left, bottom-left, bottom-right, top-right
+    float local[8] = { -origin.x, -origin.y, -origin.x, rec.height - origin.y,
+                       rec.width - origin.x, rec.height - origin.y, rec.width - origin.x, -origin.y };
+    float vertices[8] = { 0 };
 
-            rlTexCoord2f(recTexShapes.x/texShapes.width, recTexShapes.y/texShapes.height);
-            rlVertex2f(0.0f, 0.0f);
-
-            rlTexCoord2f(recTexShapes.x/texShapes.width, (recTexShapes.y + recTexShapes.height)/texShapes.height);
-            rlVertex2f(0.0f, rec.height);
+    if (rotation == 0.0f)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            vertices[2*i] = rec.x + local[2*i];
+            vertices[2*i + 1] = rec.y + local[2*i + 1];
+        }
+    }
+    else
+    {
+        float sinRotation = sinf(rotation*DEG2RAD);
+        float cosRotation = cosf(rotation*DEG2RAD);
 
-            rlTexCoord2f((recTexShapes.x + recTexShapes.width)/texShapes.width, (recTexShapes.y + recTexShapes.height)/texShapes.height);
-            rlVertex2f(rec.width, rec.height);
+        for (int i = 0; i < 4; i++)
+        {
+            vertices[2*i] = rec.x + local[2*i]*cosRotation - local[2*i + 1]*sinRotation;
+            vertices[2*i + 1] = rec.y + local[2*i]*sinRotation + local[2*i + 1]*cosRotation;
+        }
+    }
 
-            rlTexCoord2f((recTexShapes.x + recTexShapes.width)/texShapes.width, recTexShapes.y/texShapes.height);
-            rlVertex2f(rec.width, 0.0f);
-        rlEnd();
-    rlPopMatrix();
+    unsigned char colors[16] = { color.r, color.g, color.b, color.a, color.r, color.g, color.b, color.a,
+                                 color.r, color.g, color.b, color.a, color.r, color.g, color.b, color.a };
 
-    rlDisableTexture();
+    DrawShapesQuad(vertices, colors);
 }
 
 // Draw a vertical-gradient-filled rectangle
@@ -647,32 +654,11 @@ void DrawRectangleGradientH(int posX, int posY, int width, int height, Color col
 // NOTE: Colors refer to corners, starting at top-lef corner and counter-clockwise
 void DrawRectangleGradientEx(Rectangle rec, Color col1, Color col2, Color col3, Color col4)
 {
-    rlEnableTexture(GetShapesTexture().id);
-
-    rlPushMatrix();
-        rlBegin(RL_QUADS);
-            rlNormal3f(0.0f, 0.0f, 1.0f);
-
-            // NOTE: Default raylib font character 95 is a white square
-            rlColor4ub(col1.r, col1.g, col1.b, col1.a);
-            rlTexCoord2f(recTexShapes.x/texShapes.width, recTexShapes.y/texShapes.height);
-            rlVertex2f(rec.x, rec.y);
-
-            rlColor4ub(col2.r, col2.g, col2.b, col2.a);
-            rlTexCoord2f(recTexShapes.x/texShapes.width, (recTexShapes.y + recTexShapes.height)/texShapes.height);
-            rlVertex2f(rec.x, rec.y + rec.height);
+    float vertices[8] = { rec.x, rec.y, rec.x, rec.y + rec.height, rec.x + rec.width, rec.y + rec.height, rec.x + rec.width, rec.y };
+    unsigned char colors[16] = { col1.r, col1.g, col1.b, col1.a, col2.r, col2.g, col2.b, col2.a,
+                                 col3.r, col3.g, col3.b, col3.a, col4.r, col4.g, col4.b, col4.a };
 
-            rlColor4ub(col3.r, col3.g, col3.b, col3.a);
-            rlTexCoord2f((recTexShapes.x + recTexShapes.width)/texShapes.width, (recTexShapes.y + recTexShapes.height)/texShapes.height);
-            rlVertex2f(rec.x + rec.width, rec.y + rec.height);
-
-            rlColor4ub(col4.r, col4.g, col4.b, col4.a);
-            rlTexCoord2f((recTexShapes.x + recTexShapes.width)/texShapes.width, recTexShapes.y/texShapes.height);
-            rlVertex2f(rec.x + rec.width, rec.y);
-        rlEnd();
-    rlPopMatrix();
-
-    rlDisableTexture();
+    DrawShapesQuad(vertices, colors);
 }
 
 // Draw rectangle outline
@@ -1182,29 +1168,16 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, int
 // NOTE: Vertex must be provided in counter-clockwise order
 void DrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color)
 {
-    if (rlCheckBufferLimit(4)) rlglDraw();
-
 #if defined(SUPPORT_QUADS_DRAW_MODE)
-    rlEnableTexture(GetShapesTexture().id);
+    // NOTE: Triangle is drawn as a quad with second vertex repeated
+    float vertices[8] = { v1.x, v1.y, v2.x, v2.y, v2.x, v2.y, v3.x, v3.y };
+    unsigned char colors[16] = { color.r, color.g, color.b, color.a, color.r, color.g, color.b, color.a,
+                                 color.r, color.g, color.b, color.a, color.r, color.g, color.b, color.a };
 
-    rlBegin(RL_QUADS);
-        rlColor4ub(color.r, color.g, color.b, color.a);
-
-        rlTexCoord2f(recTexShapes.x/texShapes.width, recTexShapes.y/texShapes.height);
-        rlVertex2f(v1.x, v1.y);
-
-        rlTexCoord2f(recTexShapes.x/texShapes.width, (recTexShapes.y + recTexShapes.height)/texShapes.height);
-        rlVertex2f(v2.x, v2.y);
-
-        rlTexCoord2f((recTexShapes.x + recTexShapes.width)/texShapes.width, (recTexShapes.y + recTexShapes.height)/texShapes.height);
-        rlVertex2f(v2.x, v2.y);
-
-        rlTexCoord2f((recTexShapes.x + recTexShapes.width)/texShapes.width, recTexShapes.y/texShapes.height);
-        rlVertex2f(v3.x, v3.y);
-    rlEnd();
-
-    rlDisableTexture();
+    DrawShapesQuad(vertices, colors);
 #else
+    if (rlCheckBufferLimit(4)) rlglDraw();
+
     rlBegin(RL_TRIANGLES);
         rlColor4ub(color.r, color.g, color.b, color.a);
         rlVertex2f(v1.x, v1.y);
@@ -1564,3 +1537,20 @@ static Texture2D GetShapesTexture(void)
 
     return texShapes;
 }
+
+// Draw one quad with shapes texture (vertex in counter-clockwise order, one color by vertex)
+// NOTE: Quad is sent as a vertex block, batch space is reserved (and texture kept) by rlVertexArray2f()
+static void DrawShapesQuad(const float *vertices, const unsigned char *colors)
+{
+    GetShapesTexture();
+
+    float left = recTexShapes.x/texShapes.width;
+    float top = recTexShapes.y/texShapes.height;
+    float right = (recTexShapes.x + recTexShapes.width)/texShapes.width;
+    float bottom = (recTexShapes.y + recTexShapes.height)/texShapes.height;
+    float texcoords[8] = { left, top, left, bottom, right, bottom, right, top };
+
+    rlEnableTexture(texShapes.id);
+    rlVertexArray2f(RL_QUADS, vertices, texcoords, colors, 4);
+    rlDisableTexture();
+}
@@ -13,6 +13,20 @@
 *       Load default raylib font on initialization to be used by DrawText() and MeasureText().
 *       If no default font loaded, DrawTextEx() and MeasureTextEx() are required.
 *
+*   #define SUPPORT_TEXT_LAYOUT_CACHE
+*       Cache positioned glyph quads and size of strings drawn/measured more than once (LRU eviction),
+*       repeated strings are drawn copying prebuilt vertices into the batch, see SetTextLayoutCacheBudget()
+*
+*   #define TEXT_LAYOUT_CACHE_BUDGET
+*       Default memory budget in bytes of the text layout cache
+*
+*   #define FONT_ATLAS_INITIAL_SIZE
+*   #define FONT_ATLAS_MAX_SIZE
+*       Dynamic fonts atlas texture initial and maximum size, atlas size is doubled when glyphs do not fit
+*
+*   #define FONT_ATLAS_MAX_GLYPHS
+*       Default maximum number of glyphs loaded by dynamic fonts, see LoadFontDynamic()
+*
 *   #define TEXTSPLIT_MAX_TEXT_BUFFER_LENGTH
 *       TextSplit() function static buffer max size
 *
@@ -58,13 +72,21 @@
 #include <stdarg.h>         // Required for: va_list, va_start(), vsprintf(), va_end()
 #include <stdio.h>          // Required for: FILE, fopen(), fclose(), fscanf(), feof(), rewind(), fgets()
 #include <ctype.h>          // Required for: toupper(), tolower()
+#include <math.h>           // Required for: fma()
+
+#include "rlgl.h"           // raylib OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2
 
 #include "utils.h"          // Required for: fopen() Android mapping
 
+#include "rtrace.h"         // Required for: TRACE_ZONE_BEGIN(), TRACE_ZONE_END() [Only if SUPPORT_TRACING]
+
 #if defined(SUPPORT_FILEFORMAT_TTF)
     #define STB_RECT_PACK_IMPLEMENTATION
     #include "external/stb_rect_pack.h"     // Required for: ttf font rectangles packaging
 
+    #define STBTT_malloc(x,u) ((void)(u), RL_MALLOC(x))
+    #define STBTT_free(x,u) ((void)(u), RL_FREE(x))
+
     #define STBTT_STATIC
     #define STB_TRUETYPE_IMPLEMENTATION
     #include "external/stb_truetype.h"      // Required for: ttf font data reading
@@ -78,6 +100,30 @@
 
 #define MAX_TEXT_UNICODE_CHARS   512        // Maximum number of unicode codepoints
 
+#define MAX_TEXTFORMAT_BUFFERS     4        // Number of rotating static buffers: TextFormat()
+
+#define GLYPH_LOOKUP_PAGES       256        // Number of BMP pages (256 codepoints each) in glyph lookup table
+
+#if !defined(TEXT_LAYOUT_CACHE_BUDGET)
+    #define TEXT_LAYOUT_CACHE_BUDGET    (256*1024)  // Default memory budget of text layout cache (bytes)
+#endif
+
+#define TEXT_LAYOUT_CACHE_BUCKETS   256     // Hash buckets of text layout cache (power of two)
+#define TEXT_LAYOUT_CACHE_SEEN      256     // Recently missed keys, strings are cached on second use (power of two)
+#define TEXT_LAYOUT_MAX_LENGTH     1024     // Maximum text length (bytes) to be cached
+
+#if !defined(FONT_ATLAS_INITIAL_SIZE)
+    #define FONT_ATLAS_INITIAL_SIZE      256    // Dynamic font atlas initial size (width and height)
+#endif
+#if !defined(FONT_ATLAS_MAX_SIZE)
+    #define FONT_ATLAS_MAX_SIZE         2048    // Dynamic font atlas maximum size (width and height)
+#endif
+#if !defined(FONT_ATLAS_MAX_GLYPHS)
+    #define FONT_ATLAS_MAX_GLYPHS       1024    // Dynamic font default maximum number of glyphs
+#endif
+
+#define FONT_ATLAS_PADDING            2     // Dynamic font atlas padding between glyphs
+
 #if !defined(TEXTSPLIT_MAX_TEXT_BUFFER_LENGTH)
     #define TEXTSPLIT_MAX_TEXT_BUFFER_LENGTH    1024        // Size of static buffer: TextSplit()
 #endif
@@ -89,7 +135,66 @@
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Glyph lookup table, codepoint to glyph index
+// NOTE: BMP pages with glyphs use direct tables, codepoints out of BMP use an open addressing hash
+struct GlyphLookup {
+    int *pages[GLYPH_LOOKUP_PAGES];     // Glyph index by codepoint in page (-1 if not found), NULL if page has no glyphs
+    int *hashKeys;                      // Codepoints out of BMP (-1 if slot is empty)
+    int *hashValues;                    // Glyph index of hashKeys
+    int hashMask;                       // Hash slots minus one (power of two), -1 if there is no hash
+    struct FontAtlas *atlas;            // Dynamic font atlas, missing glyphs are loaded on lookup (NULL if font is static)
+};
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Skyline packer node, top of used atlas area along an horizontal segment
+typedef struct SkylineNode {
+    int x;                              // Segment start position
+    int y;                              // Used area height over segment
+    int width;                          // Segment width
+} SkylineNode;
+
+// Dynamic font atlas, glyphs are rasterized on first use and packed into a growable texture
+// NOTE: Font copies share chars, recs and glyph lookup (allocated for maxGlyphs, never moved),
+// atlas texture is recreated when it grows, current texture and charsCount are kept in font
+typedef struct FontAtlas {
+    GlyphLookup lookup;                 // Glyph lookup table (font.glyphLookup), pages allocated when glyphs are added
+    Font font;                          // Current font data
+    unsigned char *fileData;            // Font file data, glyph outlines are read from it on glyphs loading
+    stbtt_fontinfo fontInfo;            // Font info for stb_truetype
+    float scaleFactor;                  // Font scale factor for base size
+    int ascent;                         // Font ascent (baseline) for base size
+    int maxGlyphs;                      // Maximum number of glyphs (chars and recs arrays size)
+    int fallback;                       // Glyph index used for codepoints not available ('?')
+    int hashCount;                      // Codepoints in lookup hash
+    bool full;                          // Atlas could not fit a glyph (warning already reported)
+    SkylineNode *skyline;               // Skyline packer nodes, sorted by position
+    int skylineCount;                   // Skyline packer nodes count
+} FontAtlas;
+#endif
+
+#if defined(SUPPORT_TEXT_LAYOUT_CACHE)
+// Text layout cache entry, positioned glyph quads of a string
+// NOTE: Entry data (text copy, vertices, texcoords and colors) is allocated after the struct
+typedef struct TextRun {
+    struct TextRun *prev;               // LRU list previous entry (more recently used)
+    struct TextRun *next;               // LRU list next entry (less recently used)
+    struct TextRun *hashNext;           // Next entry in hash bucket
+    unsigned int hash;                  // Key hash (font, text, size and spacing)
+    unsigned int textureId;             // Font texture id (font identity, with chars)
+    const CharInfo *chars;              // Font chars
+    float fontSize;                     // Font size
+    float spacing;                      // Characters spacing
+    int length;                         // Text length in bytes
+    char *text;                         // Text copy
+    int quadsCount;                     // Number of glyph quads
+    float *vertices;                    // Quads positions relative to text position (4 vertex per quad)
+    float *texcoords;                   // Quads texture coordinates
+    unsigned char *colors;              // Quads colors, filled with last tint
+    Color tint;                         // Tint of colors array
+    Vector2 size;                       // Text size, as MeasureTextEx()
+    int bytes;                          // Entry memory size
+} TextRun;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -99,6 +204,15 @@ static Font defaultFont = { 0 };    // Default font provided by raylib
 // NOTE: defaultFont is loaded on InitWindow and disposed on CloseWindow [module: core]
 #endif
 
+#if defined(SUPPORT_TEXT_LAYOUT_CACHE)
+static TextRun *textRunBuckets[TEXT_LAYOUT_CACHE_BUCKETS] = { 0 };  // Text layout cache hash buckets
+static TextRun *textRunFirst = NULL;                                // Most recently used entry
+static TextRun *textRunLast = NULL;                                 // Least recently used entry
+static unsigned int textRunSeen[TEXT_LAYOUT_CACHE_SEEN] = { 0 };   // Recently missed keys hashes
+static int textLayoutCacheBytes = 0;                                // Text layout cache used memory
+static int textLayoutCacheBudget = TEXT_LAYOUT_CACHE_BUDGET;        // Text layout cache memory budget
+#endif
+
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
 //----------------------------------------------------------------------------------
@@ -110,6 +224,29 @@ static Font defaultFont = { 0 };    // Default font provided by raylib
 #if defined(SUPPORT_FILEFORMAT_FNT)
 static Font LoadBMFont(const char *fileName);     // Load a BMFont file (AngelCode font file)
 #endif
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static CharInfo *LoadFontDataFromMemory(const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int charsCount, int type); // Load TTF font data from memory
+static Font LoadFontAtlas(unsigned char *fileData, int dataSize, int fontSize, int maxGlyphs);    // Load dynamic font atlas (takes fileData ownership)
+static void UnloadFontAtlas(FontAtlas *atlas);                                  // Unload dynamic font atlas and font data
+static int LoadFontAtlasGlyph(FontAtlas *atlas, int codepoint);                 // Load glyph into dynamic font atlas, returns glyph index
+static Texture2D LoadFontAtlasTexture(const Font *font, int width, int height); // Load atlas texture with font glyphs images
+static bool GrowFontAtlas(FontAtlas *atlas);                                    // Grow atlas texture (double width or height)
+static int FitSkyline(const FontAtlas *atlas, int width, int height, int *x, int *y);   // Find skyline node to place a rectangle
+static void AddSkyline(FontAtlas *atlas, int index, int x, int y, int width, int height);   // Add rectangle to skyline at node
+static void AddGlyphLookup(FontAtlas *atlas, int codepoint, int index);         // Add codepoint to dynamic font glyph lookup table
+#endif
+static GlyphLookup *LoadGlyphLookup(const CharInfo *chars, int charsCount);  // Load glyph lookup table from font chars
+static Vector2 MeasureTextSize(Font font, const char *text, float fontSize, float spacing);   // Measure string size for Font (no cache)
+#if defined(SUPPORT_TEXT_LAYOUT_CACHE)
+static TextRun *GetTextRun(Font font, const char *text, float fontSize, float spacing);     // Get text layout from cache, created on second use
+static TextRun *LoadTextRun(Font font, const char *text, int length, unsigned int hash, float fontSize, float spacing); // Load text layout
+static void UnloadTextRun(TextRun *run);                                                    // Unload text layout, removed from cache
+static void UnloadTextRuns(unsigned int textureId);                                         // Unload text layouts of a font (0 for all)
+static void DrawTextRun(Font font, TextRun *run, Vector2 position, Color tint);              // Draw text layout
+#endif
+static bool IsFastFormat(const char *text);         // Check if text format is supported by fast formatting
+static int FormatTextFast(char *buffer, int bufferSize, const char *text, va_list args); // Format text without printf parsing
+static int FormatTextArgs(char *buffer, int bufferSize, const char *text, va_list args);  // Format text, fast path if supported
 
 #if defined(SUPPORT_DEFAULT_FONT)
 extern void LoadFontDefault(void);
@@ -267,6 +404,7 @@ extern void LoadFontDefault(void)
     UnloadImage(imFont);
 
     defaultFont.baseSize = (int)defaultFont.recs[0].height;
+    defaultFont.glyphLookup = LoadGlyphLookup(defaultFont.chars, defaultFont.charsCount);
 
     TraceLog(LOG_INFO, "[TEX ID %i] Default font loaded successfully", defaultFont.texture.id);
 }
@@ -278,6 +416,11 @@ extern void UnloadFontDefault(void)
     UnloadTexture(defaultFont.texture);
     RL_FREE(defaultFont.chars);
     RL_FREE(defaultFont.recs);
+    RL_FREE(defaultFont.glyphLookup);
+
+#if defined(SUPPORT_TEXT_LAYOUT_CACHE)
+    UnloadTextRuns(0);      // Default font is unloaded on CloseWindow(), all layouts are released
+#endif
 }
 #endif      // SUPPORT_DEFAULT_FONT
 
@@ -295,6 +438,8 @@ Font GetFontDefault()
 // Load Font from file into GPU memory (VRAM)
 Font LoadFont(const char *fileName)
 {
+    TRACE_ZONE_BEGIN("LoadFont");
+
     // Default hardcoded values for ttf file loading
     #define DEFAULT_TTF_FONTSIZE    32      // Font first character (32 - space)
     #define DEFAULT_TTF_NUMCHARS    95      // ASCII 32..126 is 95 glyphs
@@ -323,6 +468,8 @@ Font LoadFont(const char *fileName)
     }
     else SetTextureFilter(font.texture, FILTER_POINT);    // By default we set point filter (best performance)
 
+    TRACE_ZONE_END();
+
     return font;
 }
 
@@ -331,6 +478,8 @@ Font LoadFont(const char *fileName)
 // if array is NULL, default char set is selected 32..126
 Font LoadFontEx(const char *fileName, int fontSize, int *fontChars, int charsCount)
 {
+    TRACE_ZONE_BEGIN("LoadFontEx");
+
     Font font = { 0 };
 
     font.baseSize = fontSize;
@@ -351,6 +500,8 @@ Font LoadFontEx(const char *fileName, int fontSize, int *fontChars, int charsCou
         }
 
         UnloadImage(atlas);
+
+        font.glyphLookup = LoadGlyphLookup(font.chars, font.charsCount);
     }
     else font = GetFontDefault();
 #else
@@ -358,6 +509,116 @@ Font LoadFontEx(const char *fileName, int fontSize, int *fontChars, int charsCou
     font = GetFontDefault();
 #endif
 
+    TRACE_ZONE_END();
+
+    return font;
+}
+
+// Load font from memory buffer, fileType refers to extension: i.e. ".ttf"
+// NOTE: TTF/OTF glyphs are rasterized directly from provided buffer, image based fonts are
+// decoded with LoadImageFromMemory(), buffer can be freed (or unmapped) once this function returns
+Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int charsCount)
+{
+    Font font = { 0 };
+
+    // NOTE: File type is compared without its leading dot (i.e. ".ttf"), GetExtension() expects a file name
+    char fileExtLower[16] = { 0 };
+    snprintf(fileExtLower, sizeof(fileExtLower), "%s", TextToLower((fileType[0] == '.')? fileType + 1 : fileType));
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if (TextIsEqual(fileExtLower, "ttf") || TextIsEqual(fileExtLower, "otf"))
+    {
+        font.baseSize = fontSize;
+        font.charsCount = (charsCount > 0)? charsCount : 95;
+        font.chars = LoadFontDataFromMemory(fileData, dataSize, font.baseSize, fontChars, font.charsCount, FONT_DEFAULT);
+
+        if (font.chars != NULL)
+        {
+            Image atlas = GenImageFontAtlas(font.chars, &font.recs, font.charsCount, font.baseSize, 2, 0);
+            font.texture = LoadTextureFromImage(atlas);
+
+            // Update chars[i].image to use alpha, required to be used on ImageDrawText()
+            for (int i = 0; i < font.charsCount; i++)
+            {
+                UnloadImage(font.chars[i].image);
+                font.chars[i].image = ImageFromImage(atlas, font.recs[i]);
+            }
+
+            UnloadImage(atlas);
+
+            font.glyphLookup = LoadGlyphLookup(font.chars, font.charsCount);
+        }
+    }
+    else
+#endif
+    {
+        Image image = LoadImageFromMemory(fileType, fileData, dataSize);
+        if (image.data != NULL) font = LoadFontFromImage(image, MAGENTA, DEFAULT_FIRST_CHAR);
+        UnloadImage(image);
+    }
+
+    if (font.texture.id == 0)
+    {
+        TraceLog(LOG_WARNING, "[%s] Font could not be loaded from memory, using default font", fileType);
+        font = GetFontDefault();
+    }
+    else SetTextureFilter(font.texture, FILTER_POINT);    // By default we set point filter (best performance)
+
+    return font;
+}
+
+// Load dynamic font from TTF/OTF file, glyphs are rasterized on first use into a growable atlas
+// NOTE: maxGlyphs limits number of glyphs loaded (chars and recs are allocated for it), 0 uses default
+Font LoadFontDynamic(const char *fileName, int fontSize, int maxGlyphs)
+{
+    Font font = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    FILE *fontFile = fopen(fileName, "rb");     // Load font file
+
+    if (fontFile != NULL)
+    {
+        fseek(fontFile, 0, SEEK_END);
+        long size = ftell(fontFile);    // Get file size
+        fseek(fontFile, 0, SEEK_SET);   // Reset file pointer
+
+        unsigned char *fontBuffer = (unsigned char *)RL_MALLOC(size);
+
+        fread(fontBuffer, size, 1, fontFile);
+        fclose(fontFile);
+
+        font = LoadFontAtlas(fontBuffer, (int)size, fontSize, maxGlyphs);
+    }
+    else TraceLog(LOG_WARNING, "[%s] TTF file could not be opened", fileName);
+#else
+    TraceLog(LOG_WARNING, "[%s] TTF support is disabled", fileName);
+#endif
+
+    if (font.texture.id == 0) font = GetFontDefault();
+
+    return font;
+}
+
+// Load dynamic font from TTF/OTF memory buffer, glyphs are rasterized on first use into a growable atlas
+// NOTE: Font data is copied, buffer can be freed once this function returns
+Font LoadFontDynamicFromMemory(const unsigned char *fileData, int dataSize, int fontSize, int maxGlyphs)
+{
+    Font font = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    unsigned char *fontBuffer = (dataSize > 0)? (unsigned char *)RL_MALLOC(dataSize) : NULL;
+
+    if (fontBuffer != NULL)
+    {
+        memcpy(fontBuffer, fileData, dataSize);
+        font = LoadFontAtlas(fontBuffer, dataSize, fontSize, maxGlyphs);
+    }
+#else
+    TraceLog(LOG_WARNING, "TTF support is disabled");
+#endif
+
+    if (font.texture.id == 0) font = GetFontDefault();
+
     return font;
 }
 
@@ -473,6 +734,8 @@ Font LoadFontFromImage(Image image, Color key, int firstChar)
         font.chars[i].image = ImageFromImage(fontClear, tempCharRecs[i]);
     }
 
+    font.glyphLookup = LoadGlyphLookup(font.chars, font.charsCount);
+
     UnloadImage(fontClear);     // Unload processed image once converted to texture
 
     font.baseSize = (int)font.recs[0].height;
@@ -513,98 +776,117 @@ CharInfo *LoadFontData(const char *fileName, int fontSize, int *fontChars, int c
         fread(fontBuffer, size, 1, fontFile);
         fclose(fontFile);
 
-        // Init font for data reading
-        stbtt_fontinfo fontInfo;
-        if (!stbtt_InitFont(&fontInfo, fontBuffer, 0)) TraceLog(LOG_WARNING, "Failed to init font!");
+        chars = LoadFontDataFromMemory(fontBuffer, (int)size, fontSize, fontChars, charsCount, type);
+
+        RL_FREE(fontBuffer);
+    }
+    else TraceLog(LOG_WARNING, "[%s] TTF file could not be opened", fileName);
+#else
+    TraceLog(LOG_WARNING, "[%s] TTF support is disabled", fileName);
+#endif
+
+    return chars;
+}
 
-        // Calculate font scale factor
-        float scaleFactor = stbtt_ScaleForPixelHeight(&fontInfo, (float)fontSize);
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Load font data from TTF/OTF memory buffer
+// NOTE: stb_truetype reads glyph outlines directly from fileData, no copy is done,
+// buffer is only required to be valid while this function is running
+static CharInfo *LoadFontDataFromMemory(const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int charsCount, int type)
+{
+    CharInfo *chars = NULL;
 
-        // Calculate font basic metrics
-        // NOTE: ascent is equivalent to font baseline
-        int ascent, descent, lineGap;
-        stbtt_GetFontVMetrics(&fontInfo, &ascent, &descent, &lineGap);
+    // Init font for data reading
+    stbtt_fontinfo fontInfo;
+    if ((dataSize <= 0) || !stbtt_InitFont(&fontInfo, fileData, 0))
+    {
+        TraceLog(LOG_WARNING, "Failed to init font!");
+        return NULL;
+    }
 
-        // In case no chars count provided, default to 95
-        charsCount = (charsCount > 0)? charsCount : 95;
+    // Calculate font scale factor
+    float scaleFactor = stbtt_ScaleForPixelHeight(&fontInfo, (float)fontSize);
 
-        // Fill fontChars in case not provided externally
-        // NOTE: By default we fill charsCount consecutevely, starting at 32 (Space)
-        int genFontChars = false;
-        if (fontChars == NULL)
-        {
-            fontChars = (int *)RL_MALLOC(charsCount*sizeof(int));
-            for (int i = 0; i < charsCount; i++) fontChars[i] = i + 32;
-            genFontChars = true;
-        }
+    // Calculate font basic metrics
+    // NOTE: ascent is equivalent to font baseline
+    int ascent, descent, lineGap;
+    stbtt_GetFontVMetrics(&fontInfo, &ascent, &descent, &lineGap);
 
-        chars = (CharInfo *)RL_MALLOC(charsCount*sizeof(CharInfo));
+    // In case no chars count provided, default to 95
+    charsCount = (charsCount > 0)? charsCount : 95;
 
-        // NOTE: Using simple packaging, one char after another
-        for (int i = 0; i < charsCount; i++)
+    // Fill fontChars in case not provided externally
+    // NOTE: By default we fill charsCount consecutevely, starting at 32 (Space)
+    int genFontChars = false;
+    if (fontChars == NULL)
+    {
+        fontChars = (int *)RL_MALLOC(charsCount*sizeof(int));
+        for (int i = 0; i < charsCount; i++) fontChars[i] = i + 32;
+        genFontChars = true;
+    }
+
+    chars = (CharInfo *)RL_MALLOC(charsCount*sizeof(CharInfo));
+
+    // NOTE: Using simple packaging, one char after another
+    for (int i = 0; i < charsCount; i++)
+    {
+        int chw = 0, chh = 0;   // Character width and height (on generation)
+        int ch = fontChars[i];  // Character value to get info for
+        chars[i].value = ch;
+
+        //  Render a unicode codepoint to a bitmap
+        //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
+        //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
+        //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
+
+        if (type != FONT_SDF) chars[i].image.data = stbtt_GetCodepointBitmap(&fontInfo, scaleFactor, scaleFactor, ch, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
+        else if (ch != 32) chars[i].image.data = stbtt_GetCodepointSDF(&fontInfo, scaleFactor, ch, SDF_CHAR_PADDING, SDF_ON_EDGE_VALUE, SDF_PIXEL_DIST_SCALE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
+        else chars[i].image.data = NULL;
+        
+        stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
+        chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
+
+        // Load characters images
+        chars[i].image.width = chw;
+        chars[i].image.height = chh;
+        chars[i].image.mipmaps = 1;
+        chars[i].image.format = UNCOMPRESSED_GRAYSCALE;
+
+        chars[i].offsetY += (int)((float)ascent*scaleFactor);
+
+        // NOTE: We create an empty image for space character, it could be further required for atlas packing
+        if (ch == 32)
         {
-            int chw = 0, chh = 0;   // Character width and height (on generation)
-            int ch = fontChars[i];  // Character value to get info for
-            chars[i].value = ch;
-
-            //  Render a unicode codepoint to a bitmap
-            //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
-            //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
-            //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
-
-            if (type != FONT_SDF) chars[i].image.data = stbtt_GetCodepointBitmap(&fontInfo, scaleFactor, scaleFactor, ch, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
-            else if (ch != 32) chars[i].image.data = stbtt_GetCodepointSDF(&fontInfo, scaleFactor, ch, SDF_CHAR_PADDING, SDF_ON_EDGE_VALUE, SDF_PIXEL_DIST_SCALE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
-            else chars[i].image.data = NULL;
-            
-            stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
-            chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
-
-            // Load characters images
-            chars[i].image.width = chw;
-            chars[i].image.height = chh;
-            chars[i].image.mipmaps = 1;
-            chars[i].image.format = UNCOMPRESSED_GRAYSCALE;
-
-            chars[i].offsetY += (int)((float)ascent*scaleFactor);
-
-            // NOTE: We create an empty image for space character, it could be further required for atlas packing
-            if (ch == 32)
-            {
-                chars[i].image = GenImageColor(chars[i].advanceX, fontSize, BLANK);
-                ImageFormat(&chars[i].image, UNCOMPRESSED_GRAYSCALE);
-            }
+            chars[i].image = GenImageColor(chars[i].advanceX, fontSize, BLANK);
+            ImageFormat(&chars[i].image, UNCOMPRESSED_GRAYSCALE);
+        }
 
-            if (type == FONT_BITMAP)
+        if (type == FONT_BITMAP)
+        {
+            // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
+            // NOTE: For optimum results, bitmap font should be generated at base pixel size
+            for (int p = 0; p < chw*chh; p++)
             {
-                // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
-                // NOTE: For optimum results, bitmap font should be generated at base pixel size
-                for (int p = 0; p < chw*chh; p++)
-                {
-                    if (((unsigned char *)chars[i].image.data)[p] < BITMAP_ALPHA_THRESHOLD) ((unsigned char *)chars[i].image.data)[p] = 0;
-                    else ((unsigned char *)chars[i].image.data)[p] = 255;
-                }
+                if (((unsigned char *)chars[i].image.data)[p] < BITMAP_ALPHA_THRESHOLD) ((unsigned char *)chars[i].image.data)[p] = 0;
+                else ((unsigned char *)chars[i].image.data)[p] = 255;
             }
-
-            // Get bounding box for character (may be offset to account for chars that dip above or below the line)
-            /*
-            int chX1, chY1, chX2, chY2;
-            stbtt_GetCodepointBitmapBox(&fontInfo, ch, scaleFactor, scaleFactor, &chX1, &chY1, &chX2, &chY2);
-
-            TraceLog(LOG_DEBUG, "Character box measures: %i, %i, %i, %i", chX1, chY1, chX2 - chX1, chY2 - chY1);
-            TraceLog(LOG_DEBUG, "Character offsetY: %i", (int)((float)ascent*scaleFactor) + chY1);
-            */
         }
 
-        RL_FREE(fontBuffer);
-        if (genFontChars) RL_FREE(fontChars);
+        // Get bounding box for character (may be offset to account for chars that dip above or below the line)
+        /*
+        int chX1, chY1, chX2, chY2;
+        stbtt_GetCodepointBitmapBox(&fontInfo, ch, scaleFactor, scaleFactor, &chX1, &chY1, &chX2, &chY2);
+
+        TraceLog(LOG_DEBUG, "Character box measures: %i, %i, %i, %i", chX1, chY1, chX2 - chX1, chY2 - chY1);
+        TraceLog(LOG_DEBUG, "Character offsetY: %i", (int)((float)ascent*scaleFactor) + chY1);
+        */
     }
-    else TraceLog(LOG_WARNING, "[%s] TTF file could not be opened", fileName);
-#else
-    TraceLog(LOG_WARNING, "[%s] TTF support is disabled", fileName);
-#endif
+
+    if (genFontChars) RL_FREE(fontChars);
 
     return chars;
 }
+#endif
 
 // Generate image font atlas using chars info
 // NOTE: Packing method: 0-Default, 1-Skyline
@@ -751,14 +1033,28 @@ Image GenImageFontAtlas(const CharInfo *chars, Rectangle **charRecs, int charsCo
 // Unload Font from GPU memory (VRAM)
 void UnloadFont(Font font)
 {
+    // NOTE: Dynamic font texture and charsCount could be outdated in font copy
+    LoadFontGlyphs(&font, NULL);
+
     // NOTE: Make sure font is not default font (fallback)
     if (font.texture.id != GetFontDefault().texture.id)
     {
-        for (int i = 0; i < font.charsCount; i++) UnloadImage(font.chars[i].image);
+#if defined(SUPPORT_TEXT_LAYOUT_CACHE)
+        UnloadTextRuns(font.texture.id);
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+        if ((font.glyphLookup != NULL) && (font.glyphLookup->atlas != NULL)) UnloadFontAtlas(font.glyphLookup->atlas);
+        else
+#endif
+        {
+            for (int i = 0; i < font.charsCount; i++) UnloadImage(font.chars[i].image);
 
-        UnloadTexture(font.texture);
-        RL_FREE(font.chars);
-        RL_FREE(font.recs);
+            UnloadTexture(font.texture);
+            RL_FREE(font.chars);
+            RL_FREE(font.recs);
+            RL_FREE(font.glyphLookup);
+        }
 
         TraceLog(LOG_DEBUG, "Unloaded sprite font data");
     }
@@ -812,6 +1108,7 @@ void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float scale,
     // Character index position in sprite font
     // NOTE: In case a codepoint is not available in the font, index returned points to '?'
     int index = GetGlyphIndex(font, codepoint);
+    LoadFontGlyphs(&font, NULL);    // Dynamic font atlas texture could grow loading the glyph
 
     // Character rectangle on screen
     // NOTE: Quad is scaled proportionally to base character width-height
@@ -824,6 +1121,18 @@ void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float scale,
 // NOTE: chars spacing is NOT proportional to fontSize
 void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
 {
+    LoadFontGlyphs(&font, text);    // Dynamic font missing glyphs are loaded before drawing
+
+#if defined(SUPPORT_TEXT_LAYOUT_CACHE)
+    TextRun *run = GetTextRun(font, text, fontSize, spacing);
+
+    if (run != NULL)
+    {
+        DrawTextRun(font, run, position, tint);
+        return;
+    }
+#endif
+
     int length = strlen(text);      // Total length in bytes of the text, scanned by codepoints in loop
 
     int textOffsetY = 0;            // Offset between lines (on line break '\n')
@@ -878,6 +1187,8 @@ void DrawTextRec(Font font, const char *text, Rectangle rec, float fontSize, flo
 // Draw text using font inside rectangle limits with support for text selection
 void DrawTextRecEx(Font font, const char *text, Rectangle rec, float fontSize, float spacing, bool wordWrap, Color tint, int selectStart, int selectLength, Color selectTint, Color selectBackTint)
 {
+    LoadFontGlyphs(&font, text);    // Dynamic font missing glyphs are loaded before drawing
+
     int length = strlen(text);      // Total length in bytes of the text, scanned by codepoints in loop
 
     int textOffsetY = 0;            // Offset between lines (on line break '\n')
@@ -1030,79 +1341,107 @@ int MeasureText(const char *text, int fontSize)
 // Measure string size for Font
 Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing)
 {
-    int len = strlen(text);
-    int tempLen = 0;                // Used to count longer text line num chars
-    int lenCounter = 0;
+    LoadFontGlyphs(&font, text);    // Dynamic font missing glyphs are loaded before measuring
 
-    float textWidth = 0.0f;
-    float tempTextWidth = 0.0f;     // Used to count longer text line width
+#if defined(SUPPORT_TEXT_LAYOUT_CACHE)
+    TextRun *run = GetTextRun(font, text, fontSize, spacing);
+    if (run != NULL) return run->size;
+#endif
 
-    float textHeight = (float)font.baseSize;
-    float scaleFactor = fontSize/(float)font.baseSize;
+    return MeasureTextSize(font, text, fontSize, spacing);
+}
 
-    int letter = 0;                 // Current character
-    int index = 0;                  // Index position in sprite font
+// Set text layout cache memory budget in bytes, 0 disables the cache
+// NOTE: Least recently used layouts are released to fit new budget
+void SetTextLayoutCacheBudget(int bytes)
+{
+#if defined(SUPPORT_TEXT_LAYOUT_CACHE)
+    textLayoutCacheBudget = (bytes > 0)? bytes : 0;
 
-    for (int i = 0; i < len; i++)
-    {
-        lenCounter++;
+    while ((textRunLast != NULL) && (textLayoutCacheBytes > textLayoutCacheBudget)) UnloadTextRun(textRunLast);
+#endif
+}
 
-        int next = 0;
-        letter = GetNextCodepoint(&text[i], &next);
-        index = GetGlyphIndex(font, letter);
+// Load dynamic font glyphs used in text, font is updated with current atlas texture and charsCount
+// NOTE: Returns number of glyphs loaded, static fonts are not modified (text can be NULL to only update font)
+int LoadFontGlyphs(Font *font, const char *text)
+{
+    int count = 0;
 
-        // NOTE: normally we exit the decoding sequence as soon as a bad byte is found (and return 0x3f)
-        // but we need to draw all of the bad bytes using the '?' symbol so to not skip any we set next = 1
-        if (letter == 0x3f) next = 1;
-        i += next - 1;
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if ((font->glyphLookup == NULL) || (font->glyphLookup->atlas == NULL)) return 0;
 
-        if (letter != '\n')
-        {
-            if (font.chars[index].advanceX != 0) textWidth += font.chars[index].advanceX;
-            else textWidth += (font.recs[index].width + font.chars[index].offsetX);
-        }
-        else
+    FontAtlas *atlas = font->glyphLookup->atlas;
+    int charsCount = atlas->font.charsCount;
+
+    if (text != NULL)
+    {
+        for (int i = 0; text[i] != '\0';)
         {
-            if (tempTextWidth < textWidth) tempTextWidth = textWidth;
-            lenCounter = 0;
-            textWidth = 0;
-            textHeight += ((float)font.baseSize*1.5f); // NOTE: Fixed line spacing of 1.5 lines
-        }
+            int codepointByteCount = 0;
+            int codepoint = GetNextCodepoint(&text[i], &codepointByteCount);
+            if (codepoint == 0x3f) codepointByteCount = 1;
 
-        if (tempLen < lenCounter) tempLen = lenCounter;
-    }
+            GetGlyphIndex(atlas->font, codepoint);
 
-    if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+            i += codepointByteCount;
+        }
+    }
 
-    Vector2 vec = { 0 };
-    vec.x = tempTextWidth*scaleFactor + (float)((tempLen - 1)*spacing); // Adds chars spacing to measure
-    vec.y = textHeight*scaleFactor;
+    count = atlas->font.charsCount - charsCount;
+    *font = atlas->font;
+#endif
 
-    return vec;
+    return count;
 }
 
 // Returns index position for a unicode character on spritefont
+// NOTE: Constant time with font glyph lookup table, fonts without it use a linear search,
+// dynamic fonts load missing glyphs (atlas texture could grow, see LoadFontGlyphs())
 int GetGlyphIndex(Font font, int codepoint)
 {
 #define TEXT_CHARACTER_NOTFOUND     63      // Character: '?'
-    
-#define UNORDERED_CHARSET
-#if defined(UNORDERED_CHARSET)
-    int index = TEXT_CHARACTER_NOTFOUND;
 
-    for (int i = 0; i < font.charsCount; i++)
+    int index = -1;
+
+    if (font.glyphLookup != NULL)
+    {
+        const GlyphLookup *lookup = font.glyphLookup;
+
+        if ((codepoint >= 0) && (codepoint < GLYPH_LOOKUP_PAGES*256))
+        {
+            const int *page = lookup->pages[codepoint >> 8];
+            if (page != NULL) index = page[codepoint & 0xff];
+        }
+        else if ((codepoint >= 0) && (lookup->hashMask >= 0))
+        {
+            for (int slot = ((unsigned int)codepoint*2654435761u >> 16) & lookup->hashMask; lookup->hashKeys[slot] != -1; slot = (slot + 1) & lookup->hashMask)
+            {
+                if (lookup->hashKeys[slot] == codepoint)
+                {
+                    index = lookup->hashValues[slot];
+                    break;
+                }
+            }
+        }
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+        if ((index < 0) && (lookup->atlas != NULL)) index = LoadFontAtlasGlyph(lookup->atlas, codepoint);
+#endif
+    }
+    else
     {
-        if (font.chars[i].value == codepoint)
+        for (int i = 0; i < font.charsCount; i++)
         {
-            index = i;
-            break;
+            if (font.chars[i].value == codepoint)
+            {
+                index = i;
+                break;
+            }
         }
     }
 
-    return index;
-#else
-    return (codepoint - 32);
-#endif
+    return (index >= 0)? index : TEXT_CHARACTER_NOTFOUND;
 }
 
 // Text strings management functions
@@ -1129,35 +1468,71 @@ unsigned int TextLength(const char *text)
 }
 
 // Formatting of text with variables to 'embed'
+// NOTE: Buffers are thread local, common formats (%d, %i, %u, %x, %c, %s, %f) skip printf parsing
 // WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
 const char *TextFormat(const char *text, ...)
 {
-    #define MAX_TEXTFORMAT_BUFFERS 4
-
     // We create an array of buffers so strings don't expire until MAX_TEXTFORMAT_BUFFERS invocations
-    static char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    static int  index = 0;
-    
+    static THREAD_LOCAL char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static THREAD_LOCAL int index = 0;
+
     char *currentBuffer = buffers[index];
 
     va_list args;
     va_start(args, text);
-    vsprintf(currentBuffer, text, args);
+    FormatTextArgs(currentBuffer, MAX_TEXT_BUFFER_LENGTH, text, args);
     va_end(args);
-    
+
     index += 1;     // Move to next buffer for next function call
     if (index >= MAX_TEXTFORMAT_BUFFERS) index = 0;
 
     return currentBuffer;
 }
 
-// Get a piece of a text string
-// REQUIRES: strlen()
-const char *TextSubtext(const char *text, int position, int length)
+// Formatting of text with variables into provided buffer, text is truncated to buffer size
+// NOTE: Returns number of characters written (without '\0'), thread-safe
+int TextFormatBuffer(char *buffer, int bufferSize, const char *text, ...)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-
-    int textLength = strlen(text);
+    if ((buffer == NULL) || (bufferSize <= 0)) return 0;
+
+    va_list args;
+    va_start(args, text);
+    int length = FormatTextArgs(buffer, bufferSize, text, args);
+    va_end(args);
+
+    return length;
+}
+
+// Formatting of text with variables into frame memory
+// NOTE: String is valid until EndDrawing(), any number of strings can be used in a frame;
+// if frame arena is not available (other threads or arena full) rotating TextFormat() buffers are used
+const char *TextFormatFrame(const char *text, ...)
+{
+    char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+
+    va_list args;
+    va_start(args, text);
+    int length = FormatTextArgs(buffer, MAX_TEXT_BUFFER_LENGTH, text, args);
+    va_end(args);
+
+    char *result = NULL;
+#if defined(SUPPORT_FRAME_ARENA)
+    result = (char *)MemFrameTryAlloc(length + 1);
+#endif
+    if (result == NULL) return TextFormat("%s", buffer);
+
+    memcpy(result, buffer, length + 1);
+
+    return result;
+}
+
+// Get a piece of a text string
+// REQUIRES: strlen()
+const char *TextSubtext(const char *text, int position, int length)
+{
+    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+
+    int textLength = strlen(text);
 
     if (position >= textLength)
     {
@@ -1419,7 +1794,7 @@ char *TextToUtf8(int *codepoints, int length)
 {
     // We allocate enough memory fo fit all possible codepoints
     // NOTE: 5 bytes for every codepoint should be enough
-    char *text = (char *)calloc(length*5, 1);
+    char *text = (char *)RL_CALLOC(length*5, 1);
     const char *utf8 = NULL;
     int size = 0;
     
@@ -1633,6 +2008,925 @@ RLAPI const char *CodepointToUtf8(int codepoint, int *byteLength)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+// Load glyph lookup table from font chars
+// NOTE: Table is allocated in a single block (freed with RL_FREE()), on duplicated codepoints first glyph is used
+static GlyphLookup *LoadGlyphLookup(const CharInfo *chars, int charsCount)
+{
+    if ((chars == NULL) || (charsCount <= 0)) return NULL;
+
+    bool usedPages[GLYPH_LOOKUP_PAGES] = { 0 };
+    int pagesCount = 0;
+    int hashCount = 0;
+
+    for (int i = 0; i < charsCount; i++)
+    {
+        int codepoint = chars[i].value;
+
+        if ((codepoint >= 0) && (codepoint < GLYPH_LOOKUP_PAGES*256))
+        {
+            if (!usedPages[codepoint >> 8]) pagesCount++;
+            usedPages[codepoint >> 8] = true;
+        }
+        else if (codepoint >= 0) hashCount++;
+    }
+
+    // Hash is kept at 50% load at most
+    int hashSize = 0;
+    if (hashCount > 0) for (hashSize = 16; hashSize < 2*hashCount; hashSize *= 2) { }
+
+    int dataCount = pagesCount*256 + 2*hashSize;
+    GlyphLookup *lookup = (GlyphLookup *)RL_MALLOC(sizeof(GlyphLookup) + dataCount*sizeof(int));
+    if (lookup == NULL) return NULL;
+
+    int *data = (int *)(lookup + 1);
+    memset(data, 0xff, dataCount*sizeof(int));      // All entries set to -1
+
+    for (int i = 0, page = 0; i < GLYPH_LOOKUP_PAGES; i++) lookup->pages[i] = usedPages[i]? (data + 256*page++) : NULL;
+
+    lookup->hashKeys = data + pagesCount*256;
+    lookup->hashValues = lookup->hashKeys + hashSize;
+    lookup->hashMask = hashSize - 1;
+    lookup->atlas = NULL;
+
+    // NOTE: Glyphs are added in reverse order, so first glyph of a duplicated codepoint is kept
+    for (int i = charsCount - 1; i >= 0; i--)
+    {
+        int codepoint = chars[i].value;
+
+        if (codepoint < 0) continue;
+        else if (codepoint < GLYPH_LOOKUP_PAGES*256) lookup->pages[codepoint >> 8][codepoint & 0xff] = i;
+        else
+        {
+            int slot = ((unsigned int)codepoint*2654435761u >> 16) & lookup->hashMask;
+            while ((lookup->hashKeys[slot] != -1) && (lookup->hashKeys[slot] != codepoint)) slot = (slot + 1) & lookup->hashMask;
+
+            lookup->hashKeys[slot] = codepoint;
+            lookup->hashValues[slot] = i;
+        }
+    }
+
+    return lookup;
+}
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Load dynamic font atlas, only fallback glyph ('?') is loaded
+// NOTE: fileData is kept by atlas (glyphs are rasterized from it) and freed on UnloadFont()
+static Font LoadFontAtlas(unsigned char *fileData, int dataSize, int fontSize, int maxGlyphs)
+{
+    Font font = { 0 };
+
+    FontAtlas *atlas = (FontAtlas *)RL_CALLOC(1, sizeof(FontAtlas));
+
+    if ((atlas == NULL) || (dataSize <= 0) || !stbtt_InitFont(&atlas->fontInfo, fileData, 0))
+    {
+        TraceLog(LOG_WARNING, "Failed to init font!");
+        RL_FREE(fileData);
+        RL_FREE(atlas);
+        return font;
+    }
+
+    // NOTE: Glyphs metrics are computed as LoadFontData()
+    int ascent, descent, lineGap;
+    stbtt_GetFontVMetrics(&atlas->fontInfo, &ascent, &descent, &lineGap);
+
+    atlas->fileData = fileData;
+    atlas->scaleFactor = stbtt_ScaleForPixelHeight(&atlas->fontInfo, (float)fontSize);
+    atlas->ascent = (int)((float)ascent*atlas->scaleFactor);
+    atlas->maxGlyphs = (maxGlyphs > 0)? maxGlyphs : FONT_ATLAS_MAX_GLYPHS;
+
+    atlas->lookup.hashMask = -1;
+    atlas->lookup.atlas = atlas;
+
+    // NOTE: Skyline nodes are at least one pixel wide, one extra node is used on insertion
+    atlas->skyline = (SkylineNode *)RL_MALLOC((FONT_ATLAS_MAX_SIZE + 1)*sizeof(SkylineNode));
+    atlas->skyline[0] = (SkylineNode){ 0, 0, FONT_ATLAS_INITIAL_SIZE };
+    atlas->skylineCount = 1;
+
+    atlas->font.baseSize = fontSize;
+    atlas->font.chars = (CharInfo *)RL_CALLOC(atlas->maxGlyphs, sizeof(CharInfo));
+    atlas->font.recs = (Rectangle *)RL_CALLOC(atlas->maxGlyphs, sizeof(Rectangle));
+    atlas->font.glyphLookup = &atlas->lookup;
+    atlas->font.texture = LoadFontAtlasTexture(&atlas->font, FONT_ATLAS_INITIAL_SIZE, FONT_ATLAS_INITIAL_SIZE);
+
+    // Fallback glyph for codepoints not available in font or not fitting in atlas
+    if (atlas->font.texture.id != 0) atlas->fallback = LoadFontAtlasGlyph(atlas, '?');
+
+    if (atlas->font.charsCount == 0)
+    {
+        TraceLog(LOG_WARNING, "Font atlas could not be loaded");
+        UnloadFontAtlas(atlas);
+        return font;
+    }
+
+    TraceLog(LOG_INFO, "[TEX ID %i] Dynamic font atlas loaded (%ix%i, %i glyphs max)", atlas->font.texture.id,
+             atlas->font.texture.width, atlas->font.texture.height, atlas->maxGlyphs);
+
+    return atlas->font;
+}
+
+// Unload dynamic font atlas and font data (texture, chars, recs and glyph lookup)
+static void UnloadFontAtlas(FontAtlas *atlas)
+{
+    for (int i = 0; i < atlas->font.charsCount; i++) UnloadImage(atlas->font.chars[i].image);
+
+    UnloadTexture(atlas->font.texture);
+    RL_FREE(atlas->font.chars);
+    RL_FREE(atlas->font.recs);
+
+    for (int i = 0; i < GLYPH_LOOKUP_PAGES; i++) RL_FREE(atlas->lookup.pages[i]);
+    RL_FREE(atlas->lookup.hashKeys);
+
+    RL_FREE(atlas->skyline);
+    RL_FREE(atlas->fileData);
+    RL_FREE(atlas);
+}
+
+// Load glyph into dynamic font atlas, returns glyph index
+// NOTE: Codepoints not available in font or not fitting in atlas use fallback glyph ('?'),
+// they are also added to lookup table, so they are only checked once
+static int LoadFontAtlasGlyph(FontAtlas *atlas, int codepoint)
+{
+    Font *font = &atlas->font;
+
+    if (codepoint < 0) return atlas->fallback;
+
+    // NOTE: First glyph loaded is fallback glyph, rasterized even if not available in font
+    if ((font->charsCount > 0) && ((font->charsCount >= atlas->maxGlyphs) || (stbtt_FindGlyphIndex(&atlas->fontInfo, codepoint) == 0)))
+    {
+        if ((font->charsCount >= atlas->maxGlyphs) && !atlas->full)
+        {
+            TraceLog(LOG_WARNING, "[TEX ID %i] Dynamic font glyphs limit reached (%i), new glyphs drawn as '?'", font->texture.id, atlas->maxGlyphs);
+            atlas->full = true;
+        }
+
+        AddGlyphLookup(atlas, codepoint, atlas->fallback);
+        return atlas->fallback;
+    }
+
+    CharInfo glyph = { 0 };
+    glyph.value = codepoint;
+
+    int width = 0, height = 0;
+    unsigned char *bitmap = stbtt_GetCodepointBitmap(&atlas->fontInfo, atlas->scaleFactor, atlas->scaleFactor, codepoint, &width, &height, &glyph.offsetX, &glyph.offsetY);
+
+    stbtt_GetCodepointHMetrics(&atlas->fontInfo, codepoint, &glyph.advanceX, NULL);
+    glyph.advanceX = (int)((float)glyph.advanceX*atlas->scaleFactor);
+    glyph.offsetY += atlas->ascent;
+
+    // NOTE: Space character uses an empty image, as LoadFontData()
+    if (codepoint == 32)
+    {
+        width = glyph.advanceX;
+        height = font->baseSize;
+    }
+    else if (bitmap == NULL) width = height = 0;
+
+    // Character image uses alpha, as LoadFontEx() atlas, required to be used on ImageDrawText()
+    glyph.image.width = width;
+    glyph.image.height = height;
+    glyph.image.mipmaps = 1;
+    glyph.image.format = UNCOMPRESSED_GRAY_ALPHA;
+
+    if ((width > 0) && (height > 0))
+    {
+        unsigned char *pixels = (unsigned char *)RL_MALLOC(width*height*2);
+
+        for (int i = 0; i < width*height; i++)
+        {
+            pixels[2*i] = 255;
+            pixels[2*i + 1] = (codepoint != 32)? bitmap[i] : 0;
+        }
+
+        glyph.image.data = pixels;
+    }
+
+    stbtt_FreeBitmap(bitmap, NULL);
+
+    // Pack glyph into atlas, atlas grows until it fits
+    int x = 0, y = 0;
+    int node = FitSkyline(atlas, width + FONT_ATLAS_PADDING, height + FONT_ATLAS_PADDING, &x, &y);
+    while ((node < 0) && GrowFontAtlas(atlas)) node = FitSkyline(atlas, width + FONT_ATLAS_PADDING, height + FONT_ATLAS_PADDING, &x, &y);
+
+    if (node < 0)
+    {
+        if (!atlas->full)
+        {
+            TraceLog(LOG_WARNING, "[TEX ID %i] Dynamic font atlas is full (%ix%i), new glyphs drawn as '?'", font->texture.id, font->texture.width, font->texture.height);
+            atlas->full = true;
+        }
+
+        UnloadImage(glyph.image);
+        if (font->charsCount > 0) AddGlyphLookup(atlas, codepoint, atlas->fallback);
+
+        return atlas->fallback;
+    }
+
+    AddSkyline(atlas, node, x, y, width + FONT_ATLAS_PADDING, height + FONT_ATLAS_PADDING);
+
+    Rectangle rec = { (float)(x + FONT_ATLAS_PADDING), (float)(y + FONT_ATLAS_PADDING), (float)width, (float)height };
+
+    // Upload only glyph rectangle
+    if (glyph.image.data != NULL) UpdateTextureRec(font->texture, rec, glyph.image.data);
+
+    int index = font->charsCount;
+    font->chars[index] = glyph;
+    font->recs[index] = rec;
+    font->charsCount++;
+
+    AddGlyphLookup(atlas, codepoint, index);
+
+    return index;
+}
+
+// Load atlas texture with font glyphs images
+static Texture2D LoadFontAtlasTexture(const Font *font, int width, int height)
+{
+    Image atlas = { 0 };
+    atlas.data = RL_MALLOC(width*height*2);
+    atlas.width = width;
+    atlas.height = height;
+    atlas.mipmaps = 1;
+    atlas.format = UNCOMPRESSED_GRAY_ALPHA;
+
+    // NOTE: Transparent pixels are white, as GenImageFontAtlas(), to avoid dark borders on filtering
+    unsigned char *pixels = (unsigned char *)atlas.data;
+    for (int i = 0; i < width*height; i++)
+    {
+        pixels[2*i] = 255;
+        pixels[2*i + 1] = 0;
+    }
+
+    for (int i = 0; i < font->charsCount; i++)
+    {
+        const Image *image = &font->chars[i].image;
+        if (image->data == NULL) continue;
+
+        for (int y = 0; y < image->height; y++)
+        {
+            memcpy(pixels + 2*(((int)font->recs[i].y + y)*width + (int)font->recs[i].x), (unsigned char *)image->data + 2*y*image->width, 2*image->width);
+        }
+    }
+
+    Texture2D texture = LoadTextureFromImage(atlas);
+    UnloadImage(atlas);
+
+    return texture;
+}
+
+// Grow atlas texture (double width or height), loaded glyphs keep their position
+// NOTE: Texture is recreated, layouts and pending draws using previous texture are flushed
+static bool GrowFontAtlas(FontAtlas *atlas)
+{
+    Texture2D previous = atlas->font.texture;
+
+    int width = (previous.width <= previous.height)? 2*previous.width : previous.width;
+    int height = (previous.width <= previous.height)? previous.height : 2*previous.height;
+
+    if ((width > FONT_ATLAS_MAX_SIZE) || (height > FONT_ATLAS_MAX_SIZE)) return false;
+
+    Texture2D texture = LoadFontAtlasTexture(&atlas->font, width, height);
+    if (texture.id == 0) return false;
+
+    rlglDraw();     // Draw batch using previous texture before unloading it
+
+#if defined(SUPPORT_TEXT_LAYOUT_CACHE)
+    UnloadTextRuns(previous.id);
+#endif
+    UnloadTexture(previous);
+
+    atlas->font.texture = texture;
+
+    // Area added on the right is empty
+    if (width > previous.width)
+    {
+        SkylineNode *last = &atlas->skyline[atlas->skylineCount - 1];
+
+        if (last->y == 0) last->width += (width - previous.width);
+        else atlas->skyline[atlas->skylineCount++] = (SkylineNode){ previous.width, 0, width - previous.width };
+    }
+
+    TraceLog(LOG_INFO, "[TEX ID %i] Dynamic font atlas resized (%ix%i)", texture.id, width, height);
+
+    return true;
+}
+
+// Find skyline node to place a rectangle, lowest position is selected (bottom-left rule)
+// NOTE: Returns node index (-1 if rectangle does not fit), rectangle position is returned in x, y
+static int FitSkyline(const FontAtlas *atlas, int width, int height, int *x, int *y)
+{
+    int best = -1;
+    int bestY = 0;
+
+    for (int i = 0; i < atlas->skylineCount; i++)
+    {
+        if ((atlas->skyline[i].x + width) > atlas->font.texture.width) break;
+
+        // Rectangle rests on highest node under it
+        int top = 0;
+        for (int j = i, covered = 0; covered < width; j++)
+        {
+            if (atlas->skyline[j].y > top) top = atlas->skyline[j].y;
+            covered += atlas->skyline[j].width;
+        }
+
+        if (((top + height) <= atlas->font.texture.height) && ((best < 0) || (top < bestY)))
+        {
+            best = i;
+            bestY = top;
+        }
+    }
+
+    if (best >= 0)
+    {
+        *x = atlas->skyline[best].x;
+        *y = bestY;
+    }
+
+    return best;
+}
+
+// Add rectangle to skyline at node, placed at node position
+static void AddSkyline(FontAtlas *atlas, int index, int x, int y, int width, int height)
+{
+    SkylineNode *nodes = atlas->skyline;
+
+    memmove(&nodes[index + 1], &nodes[index], (atlas->skylineCount - index)*sizeof(SkylineNode));
+    nodes[index] = (SkylineNode){ x, y + height, width };
+    atlas->skylineCount++;
+
+    // Remove or shrink nodes covered by rectangle
+    int right = x + width;
+
+    for (int i = index + 1; (i < atlas->skylineCount) && (nodes[i].x < right);)
+    {
+        if ((nodes[i].x + nodes[i].width) <= right)
+        {
+            memmove(&nodes[i], &nodes[i + 1], (atlas->skylineCount - i - 1)*sizeof(SkylineNode));
+            atlas->skylineCount--;
+        }
+        else
+        {
+            nodes[i].width -= (right - nodes[i].x);
+            nodes[i].x = right;
+            break;
+        }
+    }
+
+    // Merge neighbour nodes with same height
+    for (int i = 0; i < (atlas->skylineCount - 1);)
+    {
+        if (nodes[i].y == nodes[i + 1].y)
+        {
+            nodes[i].width += nodes[i + 1].width;
+            memmove(&nodes[i + 1], &nodes[i + 2], (atlas->skylineCount - i - 2)*sizeof(SkylineNode));
+            atlas->skylineCount--;
+        }
+        else i++;
+    }
+}
+
+// Add codepoint to dynamic font glyph lookup table
+// NOTE: Pages are allocated on first codepoint, hash grows to keep 50% load at most
+static void AddGlyphLookup(FontAtlas *atlas, int codepoint, int index)
+{
+    GlyphLookup *lookup = &atlas->lookup;
+
+    if (codepoint < 0) return;
+    else if (codepoint < GLYPH_LOOKUP_PAGES*256)
+    {
+        int **page = &lookup->pages[codepoint >> 8];
+
+        if (*page == NULL)
+        {
+            *page = (int *)RL_MALLOC(256*sizeof(int));
+            if (*page == NULL) return;
+
+            memset(*page, 0xff, 256*sizeof(int));       // All entries set to -1
+        }
+
+        (*page)[codepoint & 0xff] = index;
+    }
+    else
+    {
+        if (2*(atlas->hashCount + 1) > (lookup->hashMask + 1))
+        {
+            int hashSize = (lookup->hashMask >= 0)? 2*(lookup->hashMask + 1) : 16;
+
+            // NOTE: Keys and values are allocated in a single block
+            int *hashKeys = (int *)RL_MALLOC(2*hashSize*sizeof(int));
+            if (hashKeys == NULL) return;
+
+            memset(hashKeys, 0xff, 2*hashSize*sizeof(int));
+            int *hashValues = hashKeys + hashSize;
+
+            for (int i = 0; i <= lookup->hashMask; i++)
+            {
+                if (lookup->hashKeys[i] == -1) continue;
+
+                int slot = ((unsigned int)lookup->hashKeys[i]*2654435761u >> 16) & (hashSize - 1);
+                while (hashKeys[slot] != -1) slot = (slot + 1) & (hashSize - 1);
+
+                hashKeys[slot] = lookup->hashKeys[i];
+                hashValues[slot] = lookup->hashValues[i];
+            }
+
+            RL_FREE(lookup->hashKeys);
+
+            lookup->hashKeys = hashKeys;
+            lookup->hashValues = hashValues;
+            lookup->hashMask = hashSize - 1;
+        }
+
+        int slot = ((unsigned int)codepoint*2654435761u >> 16) & lookup->hashMask;
+        while ((lookup->hashKeys[slot] != -1) && (lookup->hashKeys[slot] != codepoint)) slot = (slot + 1) & lookup->hashMask;
+
+        if (lookup->hashKeys[slot] == -1) atlas->hashCount++;
+
+        lookup->hashKeys[slot] = codepoint;
+        lookup->hashValues[slot] = index;
+    }
+}
+#endif
+
+// Measure string size for Font (no cache)
+static Vector2 MeasureTextSize(Font font, const char *text, float fontSize, float spacing)
+{
+    int len = strlen(text);
+    int tempLen = 0;                // Used to count longer text line num chars
+    int lenCounter = 0;
+
+    float textWidth = 0.0f;
+    float tempTextWidth = 0.0f;     // Used to count longer text line width
+
+    float textHeight = (float)font.baseSize;
+    float scaleFactor = fontSize/(float)font.baseSize;
+
+    int letter = 0;                 // Current character
+    int index = 0;                  // Index position in sprite font
+
+    for (int i = 0; i < len; i++)
+    {
+        lenCounter++;
+
+        int next = 0;
+        letter = GetNextCodepoint(&text[i], &next);
+        index = GetGlyphIndex(font, letter);
+
+        // NOTE: normally we exit the decoding sequence as soon as a bad byte is found (and return 0x3f)
+        // but we need to draw all of the bad bytes using the '?' symbol so to not skip any we set next = 1
+        if (letter == 0x3f) next = 1;
+        i += next - 1;
+
+        if (letter != '\n')
+        {
+            if (font.chars[index].advanceX != 0) textWidth += font.chars[index].advanceX;
+            else textWidth += (font.recs[index].width + font.chars[index].offsetX);
+        }
+        else
+        {
+            if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+            lenCounter = 0;
+            textWidth = 0;
+            textHeight += ((float)font.baseSize*1.5f); // NOTE: Fixed line spacing of 1.5 lines
+        }
+
+        if (tempLen < lenCounter) tempLen = lenCounter;
+    }
+
+    if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+
+    Vector2 vec = { 0 };
+    vec.x = tempTextWidth*scaleFactor + (float)((tempLen - 1)*spacing); // Adds chars spacing to measure
+    vec.y = textHeight*scaleFactor;
+
+    return vec;
+}
+
+#if defined(SUPPORT_TEXT_LAYOUT_CACHE)
+// Get text layout from cache, created on second use
+// NOTE: Strings used only once (i.e. values changing every frame) are not cached, NULL is returned
+static TextRun *GetTextRun(Font font, const char *text, float fontSize, float spacing)
+{
+    if ((textLayoutCacheBudget == 0) || (font.texture.id == 0) || (font.chars == NULL)) return NULL;
+
+    // Key hash: text (FNV-1a), font, size and spacing
+    unsigned int hash = 2166136261u;
+    int length = 0;
+
+    for (; text[length] != '\0'; length++)
+    {
+        if (length >= TEXT_LAYOUT_MAX_LENGTH) return NULL;
+        hash = (hash ^ (unsigned char)text[length])*16777619u;
+    }
+
+    unsigned int sizeBits = 0;
+    unsigned int spacingBits = 0;
+    memcpy(&sizeBits, &fontSize, sizeof(float));
+    memcpy(&spacingBits, &spacing, sizeof(float));
+
+    hash = (hash ^ font.texture.id)*16777619u;
+    hash = (hash ^ (unsigned int)(size_t)font.chars)*16777619u;
+    hash = (hash ^ sizeBits)*16777619u;
+    hash = (hash ^ spacingBits)*16777619u;
+
+    TextRun *run = textRunBuckets[hash & (TEXT_LAYOUT_CACHE_BUCKETS - 1)];
+
+    while ((run != NULL) && ((run->hash != hash) || (run->textureId != font.texture.id) || (run->chars != font.chars) ||
+           (run->fontSize != fontSize) || (run->spacing != spacing) || (run->length != length) || (memcmp(run->text, text, length) != 0))) run = run->hashNext;
+
+    if (run != NULL)
+    {
+        // Move entry to LRU list front
+        if (run != textRunFirst)
+        {
+            run->prev->next = run->next;
+            if (run->next != NULL) run->next->prev = run->prev;
+            else textRunLast = run->prev;
+
+            run->prev = NULL;
+            run->next = textRunFirst;
+            textRunFirst->prev = run;
+            textRunFirst = run;
+        }
+
+        return run;
+    }
+
+    // First use of the string is only registered
+    unsigned int *seen = &textRunSeen[hash & (TEXT_LAYOUT_CACHE_SEEN - 1)];
+    if (*seen != hash)
+    {
+        *seen = hash;
+        return NULL;
+    }
+
+    run = LoadTextRun(font, text, length, hash, fontSize, spacing);
+    if (run == NULL) return NULL;
+
+    // Insert entry at LRU list front and hash bucket
+    run->next = textRunFirst;
+    if (textRunFirst != NULL) textRunFirst->prev = run;
+    else textRunLast = run;
+    textRunFirst = run;
+
+    run->hashNext = textRunBuckets[hash & (TEXT_LAYOUT_CACHE_BUCKETS - 1)];
+    textRunBuckets[hash & (TEXT_LAYOUT_CACHE_BUCKETS - 1)] = run;
+
+    textLayoutCacheBytes += run->bytes;
+
+    // Release least recently used entries over budget
+    while ((textLayoutCacheBytes > textLayoutCacheBudget) && (textRunLast != run)) UnloadTextRun(textRunLast);
+
+    return run;
+}
+
+// Load text layout, glyph quads placed as DrawTextEx() and size measured as MeasureTextEx()
+static TextRun *LoadTextRun(Font font, const char *text, int length, unsigned int hash, float fontSize, float spacing)
+{
+    // Count quads, spaces and line breaks are not drawn
+    int quadsCount = 0;
+
+    for (int i = 0; i < length; i++)
+    {
+        int codepointByteCount = 0;
+        int codepoint = GetNextCodepoint(&text[i], &codepointByteCount);
+        if (codepoint == 0x3f) codepointByteCount = 1;
+
+        if ((codepoint != '\n') && (codepoint != ' ') && (codepoint != '\t')) quadsCount++;
+
+        i += (codepointByteCount - 1);
+    }
+
+    int bytes = sizeof(TextRun) + quadsCount*(16*sizeof(float) + 16*sizeof(unsigned char)) + length + 1;
+    if (bytes > textLayoutCacheBudget) return NULL;
+
+    TextRun *run = (TextRun *)RL_MALLOC(bytes);
+    if (run == NULL) return NULL;
+
+    run->prev = NULL;
+    run->next = NULL;
+    run->hashNext = NULL;
+    run->hash = hash;
+    run->textureId = font.texture.id;
+    run->chars = font.chars;
+    run->fontSize = fontSize;
+    run->spacing = spacing;
+    run->length = length;
+    run->quadsCount = quadsCount;
+    run->vertices = (float *)(run + 1);
+    run->texcoords = run->vertices + 8*quadsCount;
+    run->colors = (unsigned char *)(run->texcoords + 8*quadsCount);
+    run->text = (char *)(run->colors + 16*quadsCount);
+    run->tint = WHITE;
+    run->size = MeasureTextSize(font, text, fontSize, spacing);
+    run->bytes = bytes;
+
+    memcpy(run->text, text, length);
+    run->text[length] = '\0';
+    memset(run->colors, 255, 16*quadsCount);
+
+    // NOTE: Same layout as DrawTextEx() and DrawTexturePro() quads
+    float scaleFactor = fontSize/font.baseSize;
+    float width = (float)font.texture.width;
+    float height = (float)font.texture.height;
+
+    int textOffsetY = 0;
+    float textOffsetX = 0.0f;
+    float *vertex = run->vertices;
+    float *texcoord = run->texcoords;
+
+    for (int i = 0; i < length; i++)
+    {
+        int codepointByteCount = 0;
+        int codepoint = GetNextCodepoint(&text[i], &codepointByteCount);
+        int index = GetGlyphIndex(font, codepoint);
+
+        if (codepoint == 0x3f) codepointByteCount = 1;
+
+        if (codepoint == '\n')
+        {
+            textOffsetY += (int)((font.baseSize + font.baseSize/2)*scaleFactor);
+            textOffsetX = 0.0f;
+        }
+        else
+        {
+            if ((codepoint != ' ') && (codepoint != '\t'))
+            {
+                Rectangle source = font.recs[index];
+                float x = textOffsetX + font.chars[index].offsetX*scaleFactor;
+                float y = textOffsetY + font.chars[index].offsetY*scaleFactor;
+                float w = source.width*scaleFactor;
+                float h = source.height*scaleFactor;
+
+                vertex[0] = x; vertex[1] = y;
+                vertex[2] = x; vertex[3] = y + h;
+                vertex[4] = x + w; vertex[5] = y + h;
+                vertex[6] = x + w; vertex[7] = y;
+
+                texcoord[0] = source.x/width; texcoord[1] = source.y/height;
+                texcoord[2] = source.x/width; texcoord[3] = (source.y + source.height)/height;
+                texcoord[4] = (source.x + source.width)/width; texcoord[5] = (source.y + source.height)/height;
+                texcoord[6] = (source.x + source.width)/width; texcoord[7] = source.y/height;
+
+                vertex += 8;
+                texcoord += 8;
+            }
+
+            if (font.chars[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
+            else textOffsetX += ((float)font.chars[index].advanceX*scaleFactor + spacing);
+        }
+
+        i += (codepointByteCount - 1);
+    }
+
+    return run;
+}
+
+// Unload text layout, removed from cache
+static void UnloadTextRun(TextRun *run)
+{
+    if (run->prev != NULL) run->prev->next = run->next;
+    else textRunFirst = run->next;
+
+    if (run->next != NULL) run->next->prev = run->prev;
+    else textRunLast = run->prev;
+
+    TextRun **bucket = &textRunBuckets[run->hash & (TEXT_LAYOUT_CACHE_BUCKETS - 1)];
+    while (*bucket != run) bucket = &(*bucket)->hashNext;
+    *bucket = run->hashNext;
+
+    textLayoutCacheBytes -= run->bytes;
+
+    RL_FREE(run);
+}
+
+// Unload text layouts of a font (0 for all)
+static void UnloadTextRuns(unsigned int textureId)
+{
+    for (TextRun *run = textRunFirst, *next = NULL; run != NULL; run = next)
+    {
+        next = run->next;
+        if ((textureId == 0) || (run->textureId == textureId)) UnloadTextRun(run);
+    }
+
+    if (textureId == 0) memset(textRunSeen, 0, sizeof(textRunSeen));
+}
+
+// Draw text layout, prebuilt quads are copied into the batch
+static void DrawTextRun(Font font, TextRun *run, Vector2 position, Color tint)
+{
+    if (run->quadsCount == 0) return;
+
+    // Colors are refilled only when tint changes
+    if ((run->tint.r != tint.r) || (run->tint.g != tint.g) || (run->tint.b != tint.b) || (run->tint.a != tint.a))
+    {
+        for (int i = 0; i < 4*run->quadsCount; i++) memcpy(run->colors + 4*i, &tint, 4);
+        run->tint = tint;
+    }
+
+    rlEnableTexture(font.texture.id);
+
+    rlPushMatrix();
+        rlTranslatef(position.x, position.y, 0.0f);
+        rlVertexArray2f(RL_QUADS, run->vertices, run->texcoords, run->colors, 4*run->quadsCount);
+    rlPopMatrix();
+
+    rlDisableTexture();
+}
+#endif
+
+// Check if text format is supported by fast formatting
+// NOTE: Supported specifiers: %d, %i, %u, %x, %c, %s, %f and %%, with optional '0' flag,
+// width (1 digit) and precision (1 digit, %f only); length modifiers are not supported
+static bool IsFastFormat(const char *text)
+{
+    for (const char *c = text; *c != '\0'; c++)
+    {
+        if (*c != '%') continue;
+
+        c++;
+        if (*c == '0') c++;
+        if ((*c >= '1') && (*c <= '9')) c++;
+
+        if (*c == '.')
+        {
+            c++;
+            if ((*c < '0') || (*c > '9')) return false;
+            c++;
+            if (*c != 'f') return false;
+        }
+
+        switch (*c)
+        {
+            case 'd': case 'i': case 'u': case 'x': case 'c': case 's': case 'f': case '%': break;
+            default: return false;
+        }
+    }
+
+    return true;
+}
+
+// Format text without printf parsing (format must be checked with IsFastFormat())
+// NOTE: Floats out of range, inf/nan (or precision > 9) are formatted with snprintf()
+static int FormatTextFast(char *buffer, int bufferSize, const char *text, va_list args)
+{
+    static const double powers[10] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9 };
+
+    int length = 0;
+    char item[64] = { 0 };          // Current formatted argument, reversed digits are written from the end
+
+    for (const char *c = text; (*c != '\0') && (length < bufferSize - 1); c++)
+    {
+        if (*c != '%')
+        {
+            buffer[length++] = *c;
+            continue;
+        }
+
+        c++;
+        bool zeroPad = false;
+        int width = 0;
+        int precision = 6;
+
+        if (*c == '0') { zeroPad = true; c++; }
+        if ((*c >= '1') && (*c <= '9')) { width = *c - '0'; c++; }
+        if (*c == '.') { precision = c[1] - '0'; c += 2; }
+
+        const char *itemText = item + sizeof(item);
+        int itemLength = 0;
+        bool negative = false;
+
+        switch (*c)
+        {
+            case 'd':
+            case 'i':
+            case 'u':
+            case 'x':
+            {
+                unsigned int value = 0;
+                unsigned int base = (*c == 'x')? 16 : 10;
+
+                if ((*c == 'd') || (*c == 'i'))
+                {
+                    int signedValue = va_arg(args, int);
+                    negative = (signedValue < 0);
+                    value = negative? (0u - (unsigned int)signedValue) : (unsigned int)signedValue;
+                }
+                else value = va_arg(args, unsigned int);
+
+                char *digit = item + sizeof(item);
+                do
+                {
+                    *--digit = "0123456789abcdef"[value%base];
+                    value /= base;
+                } while (value > 0);
+                if (negative && !zeroPad) *--digit = '-';
+
+                itemText = digit;
+                itemLength = (int)(item + sizeof(item) - digit);
+            } break;
+            case 'f':
+            {
+                double value = va_arg(args, double);
+                double absValue = (value < 0.0)? -value : value;
+
+                // NOTE: Scaled value must be an exact integer part (2^53), NaN fails comparison
+                // Other values are written to buffer by snprintf() with padding (zero flag is not applied to inf/nan)
+                if ((precision > 9) || !(absValue*powers[precision] < 9007199254740992.0))
+                {
+                    int written = snprintf(buffer + length, bufferSize - length, zeroPad? "%0*.*f" : "%*.*f", width, precision, value);
+                    if (written > 0) length += (written < (bufferSize - length))? written : (bufferSize - 1 - length);
+
+                    width = 0;
+                    zeroPad = false;
+                    break;
+                }
+
+                // Round to precision digits as printf (exact value, halfway cases to even)
+                // NOTE: Scaling error only matters on halfway cases, it is computed with fma()
+                double scaled = absValue*powers[precision];
+                unsigned long long whole = (unsigned long long)scaled;
+                double fraction = scaled - (double)whole;
+
+                if (fraction == 0.5)
+                {
+                    double error = fma(absValue, powers[precision], -scaled);
+                    if ((error > 0.0) || ((error == 0.0) && (whole & 1))) whole++;
+                }
+                else if (fraction > 0.5) whole++;
+
+                negative = (value < 0.0) || ((value == 0.0) && (1.0/value < 0.0));
+
+                char *digit = item + sizeof(item);
+                for (int i = 0; i < precision; i++)
+                {
+                    *--digit = '0' + (char)(whole%10);
+                    whole /= 10;
+                }
+                if (precision > 0) *--digit = '.';
+                do
+                {
+                    *--digit = '0' + (char)(whole%10);
+                    whole /= 10;
+                } while (whole > 0);
+                if (negative && !zeroPad) *--digit = '-';
+
+                itemText = digit;
+                itemLength = (int)(item + sizeof(item) - digit);
+            } break;
+            case 'c':
+            {
+                item[0] = (char)va_arg(args, int);
+                itemText = item;
+                itemLength = 1;
+            } break;
+            case 's':
+            {
+                itemText = va_arg(args, const char *);
+                if (itemText == NULL) itemText = "(null)";
+                itemLength = (int)strlen(itemText);
+                zeroPad = false;
+            } break;
+            case '%':
+            {
+                itemText = "%";
+                itemLength = 1;
+            } break;
+            default: break;
+        }
+
+        // Sign is written before zero padding
+        if (negative && zeroPad)
+        {
+            buffer[length++] = '-';
+            width--;
+        }
+
+        for (int i = itemLength; (i < width) && (length < bufferSize - 1); i++) buffer[length++] = zeroPad? '0' : ' ';
+
+        if (itemLength > bufferSize - 1 - length) itemLength = bufferSize - 1 - length;
+        memcpy(buffer + length, itemText, itemLength);
+        length += itemLength;
+    }
+
+    buffer[length] = '\0';
+
+    return length;
+}
+
+// Format text, fast path if supported
+static int FormatTextArgs(char *buffer, int bufferSize, const char *text, va_list args)
+{
+    if (IsFastFormat(text)) return FormatTextFast(buffer, bufferSize, text, args);
+
+    int length = vsnprintf(buffer, bufferSize, text, args);
+
+    if (length < 0) { buffer[0] = '\0'; length = 0; }
+    else if (length > bufferSize - 1) length = bufferSize - 1;
+
+    return length;
+}
+
 #if defined(SUPPORT_FILEFORMAT_FNT)
 // Load a BMFont file (AngelCode font file)
 static Font LoadBMFont(const char *fileName)
@@ -1747,6 +3041,8 @@ static Font LoadBMFont(const char *fileName)
         font.chars[i].image = ImageFromImage(imFont, font.recs[i]);
     }
 
+    font.glyphLookup = LoadGlyphLookup(font.chars, font.charsCount);
+
     UnloadImage(imFont);
 
     fclose(fntFile);
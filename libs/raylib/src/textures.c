@@ -65,7 +65,7 @@
 #endif
 
 #include <stdlib.h>             // Required for: malloc(), free()
-#include <string.h>             // Required for: strlen()
+#include <string.h>             // Required for: strlen(), memcpy()
 #include <stdio.h>              // Required for: FILE, fopen(), fclose(), fread()
 
 #include "utils.h"              // Required for: fopen() Android mapping
@@ -74,6 +74,8 @@
                                 // Required for: rlLoadTexture() rlDeleteTextures(),
                                 //      rlGenerateMipmaps(), some funcs for DrawTexturePro()
 
+#include "rtrace.h"             // Required for: TRACE_ZONE_BEGIN(), TRACE_ZONE_END() [Only if SUPPORT_TRACING]
+
 // Support only desired texture formats on stb_image
 #if !defined(SUPPORT_FILEFORMAT_BMP)
     #define STBI_NO_BMP
@@ -123,11 +125,18 @@
 #endif
 
 #if defined(SUPPORT_IMAGE_EXPORT)
+    #define STBIW_MALLOC RL_MALLOC
+    #define STBIW_FREE RL_FREE
+    #define STBIW_REALLOC RL_REALLOC
+
     #define STB_IMAGE_WRITE_IMPLEMENTATION
     #include "external/stb_image_write.h"   // Required for: stbi_write_*()
 #endif
 
 #if defined(SUPPORT_IMAGE_MANIPULATION)
+    #define STBIR_MALLOC(size,c) ((void)(c), RL_MALLOC(size))
+    #define STBIR_FREE(ptr,c) ((void)(c), RL_FREE(ptr))
+
     #define STB_IMAGE_RESIZE_IMPLEMENTATION
     #include "external/stb_image_resize.h"  // Required for: stbir_resize_uint8()
                                             // NOTE: Used for image scaling on ImageResize()
@@ -181,6 +190,9 @@ static Image LoadPVR(const char *fileName);   // Load PVR file
 static Image LoadASTC(const char *fileName);  // Load ASTC file
 #endif
 
+static void ReadImagePixels(Image image, Color *pixels);   // Read image pixel data into a Color array
+static Color *GetImageDataFrame(Image image);   // Get image pixel data into transient frame memory
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition
 //----------------------------------------------------------------------------------
@@ -188,6 +200,8 @@ static Image LoadASTC(const char *fileName);  // Load ASTC file
 // Load image from file into CPU memory (RAM)
 Image LoadImage(const char *fileName)
 {
+    TRACE_ZONE_BEGIN("LoadImage");
+
     Image image = { 0 };
 
 #if defined(SUPPORT_FILEFORMAT_PNG) || \
@@ -294,6 +308,91 @@ Image LoadImage(const char *fileName)
     if (image.data != NULL) TraceLog(LOG_INFO, "[%s] Image loaded successfully (%ix%i)", fileName, image.width, image.height);
     else TraceLog(LOG_WARNING, "[%s] Image could not be loaded", fileName);
 
+    TRACE_ZONE_END();
+
+    return image;
+}
+
+// Load image from memory buffer, fileType refers to extension: i.e. ".png"
+// NOTE: Image is decoded directly from provided buffer, no intermediate copy is done,
+// buffer is owned by the caller and can be freed (or unmapped) once this function returns
+Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize)
+{
+    Image image = { 0 };
+
+    if ((fileData == NULL) || (dataSize <= 0))
+    {
+        TraceLog(LOG_WARNING, "[%s] Image data provided is not valid", fileType);
+        return image;
+    }
+
+    // NOTE: fileType is a bare extension (not a file name), leading dot is skipped and case is ignored
+    char fileExtLower[16] = { 0 };
+    snprintf(fileExtLower, sizeof(fileExtLower), "%s", TextToLower((fileType[0] == '.')? fileType + 1 : fileType));
+
+#if defined(SUPPORT_FILEFORMAT_PNG)
+    if ((TextIsEqual(fileExtLower, "png"))
+#else
+    if ((false)
+#endif
+#if defined(SUPPORT_FILEFORMAT_BMP)
+        || (TextIsEqual(fileExtLower, "bmp"))
+#endif
+#if defined(SUPPORT_FILEFORMAT_TGA)
+        || (TextIsEqual(fileExtLower, "tga"))
+#endif
+#if defined(SUPPORT_FILEFORMAT_JPG)
+        || (TextIsEqual(fileExtLower, "jpg"))
+#endif
+#if defined(SUPPORT_FILEFORMAT_GIF)
+        || (TextIsEqual(fileExtLower, "gif"))
+#endif
+#if defined(SUPPORT_FILEFORMAT_PIC)
+        || (TextIsEqual(fileExtLower, "pic"))
+#endif
+#if defined(SUPPORT_FILEFORMAT_PSD)
+        || (TextIsEqual(fileExtLower, "psd"))
+#endif
+       )
+    {
+#if defined(STBI_REQUIRED)
+        int imgBpp = 0;
+
+        // NOTE: Using stb_image to load images (Supports multiple image formats)
+        image.data = stbi_load_from_memory(fileData, dataSize, &image.width, &image.height, &imgBpp, 0);
+        image.mipmaps = 1;
+
+        if (imgBpp == 1) image.format = UNCOMPRESSED_GRAYSCALE;
+        else if (imgBpp == 2) image.format = UNCOMPRESSED_GRAY_ALPHA;
+        else if (imgBpp == 3) image.format = UNCOMPRESSED_R8G8B8;
+        else if (imgBpp == 4) image.format = UNCOMPRESSED_R8G8B8A8;
+#endif
+    }
+#if defined(SUPPORT_FILEFORMAT_HDR)
+    else if (TextIsEqual(fileExtLower, "hdr"))
+    {
+        int imgBpp = 0;
+
+        // Load 32 bit per channel floats data
+        image.data = stbi_loadf_from_memory(fileData, dataSize, &image.width, &image.height, &imgBpp, 0);
+        image.mipmaps = 1;
+
+        if (imgBpp == 1) image.format = UNCOMPRESSED_R32;
+        else if (imgBpp == 3) image.format = UNCOMPRESSED_R32G32B32;
+        else if (imgBpp == 4) image.format = UNCOMPRESSED_R32G32B32A32;
+        else
+        {
+            TraceLog(LOG_WARNING, "[%s] Image fileformat not supported", fileType);
+            UnloadImage(image);
+            image.data = NULL;
+        }
+    }
+#endif
+    else TraceLog(LOG_WARNING, "[%s] Image fileformat not supported from memory", fileType);
+
+    if (image.data != NULL) TraceLog(LOG_INFO, "[%s] Image loaded successfully from memory (%ix%i)", fileType, image.width, image.height);
+    else TraceLog(LOG_WARNING, "[%s] Image could not be loaded from memory", fileType);
+
     return image;
 }
 
@@ -388,6 +487,8 @@ Image LoadImageRaw(const char *fileName, int width, int height, int format, int
 // Load texture from file into GPU memory (VRAM)
 Texture2D LoadTexture(const char *fileName)
 {
+    TRACE_ZONE_BEGIN("LoadTexture");
+
     Texture2D texture = { 0 };
 
     Image image = LoadImage(fileName);
@@ -399,6 +500,8 @@ Texture2D LoadTexture(const char *fileName)
     }
     else TraceLog(LOG_WARNING, "Texture could not be created");
 
+    TRACE_ZONE_END();
+
     return texture;
 }
 
@@ -458,115 +561,10 @@ void UnloadRenderTexture(RenderTexture2D target)
 Color *GetImageData(Image image)
 {
     if ((image.width == 0) || (image.height == 0)) return NULL;
-    
-    Color *pixels = (Color *)RL_MALLOC(image.width*image.height*sizeof(Color));
-    
-    if (image.format >= COMPRESSED_DXT1_RGB) TraceLog(LOG_WARNING, "Pixel data retrieval not supported for compressed image formats");
-    else
-    {
-        if ((image.format == UNCOMPRESSED_R32) ||
-            (image.format == UNCOMPRESSED_R32G32B32) ||
-            (image.format == UNCOMPRESSED_R32G32B32A32)) TraceLog(LOG_WARNING, "32bit pixel format converted to 8bit per channel");
-
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
-        {
-            switch (image.format)
-            {
-                case UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[i];
-                    pixels[i].g = ((unsigned char *)image.data)[i];
-                    pixels[i].b = ((unsigned char *)image.data)[i];
-                    pixels[i].a = 255;
-
-                } break;
-                case UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k];
-                    pixels[i].b = ((unsigned char *)image.data)[k];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 1];
-
-                    k += 2;
-                } break;
-                case UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
-                    pixels[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
-
-                } break;
-                case UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
-                    pixels[i].b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
-                    pixels[i].a = 255;
-
-                } break;
-                case UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
-                    pixels[i].a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
-
-                } break;
-                case UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = ((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 3];
-
-                    k += 4;
-                } break;
-                case UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].r = (unsigned char)((unsigned char *)image.data)[k];
-                    pixels[i].g = (unsigned char)((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = (unsigned char)((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = 255;
 
-                    k += 3;
-                } break;
-                case UNCOMPRESSED_R32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = 0;
-                    pixels[i].b = 0;
-                    pixels[i].a = 255;
-
-                } break;
-                case UNCOMPRESSED_R32G32B32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
-                    pixels[i].a = 255;
-
-                    k += 3;
-                } break;
-                case UNCOMPRESSED_R32G32B32A32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].a = (unsigned char)(((float *)image.data)[k]*255.0f);
+    Color *pixels = (Color *)RL_MALLOC(image.width*image.height*sizeof(Color));
 
-                    k += 4;
-                } break;
-                default: break;
-            }
-        }
-    }
+    ReadImagePixels(image, pixels);
 
     return pixels;
 }
@@ -813,6 +811,19 @@ void UpdateTexture(Texture2D texture, const void *pixels)
     rlUpdateTexture(texture.id, texture.width, texture.height, texture.format, pixels);
 }
 
+// Update GPU texture rectangle with new data
+// NOTE: pixels data must match texture.format and contain rec.width*rec.height pixels
+void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels)
+{
+    if ((rec.x < 0) || (rec.y < 0) || ((rec.x + rec.width) > texture.width) || ((rec.y + rec.height) > texture.height))
+    {
+        TraceLog(LOG_WARNING, "Texture rectangle to update is out of texture bounds");
+        return;
+    }
+
+    rlUpdateTextureRec(texture.id, (int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, texture.format, pixels);
+}
+
 // Export image data to file
 // NOTE: File format depends on fileName extension
 void ExportImage(Image image, const char *fileName)
@@ -1834,7 +1845,13 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
         TraceLog(LOG_WARNING, "Source rectangle height out of bounds, rescaled height: %i", srcRec.height);
     }
 
-    Image srcCopy = ImageCopy(src);     // Make a copy of source image to work with it
+    // NOTE: Source image is only copied if it has to be cropped or scaled
+    bool srcCopyRequired = ((src.width != (int)srcRec.width) && (src.height != (int)srcRec.height)) ||
+                           ((int)dstRec.width != (int)srcRec.width) || ((int)dstRec.height != (int)srcRec.height) ||
+                           (dstRec.x < 0) || ((dstRec.x + dstRec.width) > dst->width) ||
+                           (dstRec.y < 0) || ((dstRec.y + dstRec.height) > dst->height);
+
+    Image srcCopy = srcCopyRequired? ImageCopy(src) : src;  // Make a copy of source image to work with it
 
     // Crop source image to desired source rectangle (if required)
     if ((src.width != (int)srcRec.width) && (src.height != (int)srcRec.height)) ImageCrop(&srcCopy, srcRec);
@@ -1874,10 +1891,10 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
     }
 
     // Get image data as Color pixels array to work with it
-    Color *dstPixels = GetImageData(*dst);
-    Color *srcPixels = GetImageData(srcCopy);
+    Color *dstPixels = GetImageDataFrame(*dst);
+    Color *srcPixels = GetImageDataFrame(srcCopy);
 
-    UnloadImage(srcCopy);       // Source copy not required any more
+    if (srcCopyRequired) UnloadImage(srcCopy);      // Source copy not required any more
 
     Vector4 fsrc, fdst, fout;   // Normalized pixel data (ready for operation)
     Vector4 ftint = ColorNormalize(tint);   // Normalized color tint
@@ -1920,13 +1937,18 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
         }
     }
 
-    UnloadImage(*dst);
+    // NOTE: RGBA destination without mipmaps is updated in place, no new image data required
+    if ((dst->format == UNCOMPRESSED_R8G8B8A8) && (dst->mipmaps == 1)) memcpy(dst->data, dstPixels, dst->width*dst->height*sizeof(Color));
+    else
+    {
+        UnloadImage(*dst);
 
-    *dst = LoadImageEx(dstPixels, (int)dst->width, (int)dst->height);
-    ImageFormat(dst, dst->format);
+        *dst = LoadImageEx(dstPixels, (int)dst->width, (int)dst->height);
+        ImageFormat(dst, dst->format);
+    }
 
-    RL_FREE(srcPixels);
-    RL_FREE(dstPixels);
+    RL_FRAME_FREE(srcPixels);
+    RL_FRAME_FREE(dstPixels);
 }
 
 // Create an image from text (default font)
@@ -2001,11 +2023,21 @@ Image ImageTextEx(Font font, const char *text, float fontSize, float spacing, Co
 void ImageDrawRectangle(Image *dst, Rectangle rec, Color color)
 {
     // Security check to avoid program crash
-    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0) || ((int)rec.width <= 0) || ((int)rec.height <= 0)) return;
+
+    // NOTE: Rectangle image only lives during drawing, it uses transient frame memory
+    Image imRec = { 0 };
+    imRec.width = (int)rec.width;
+    imRec.height = (int)rec.height;
+    imRec.mipmaps = 1;
+    imRec.format = UNCOMPRESSED_R8G8B8A8;
+    imRec.data = RL_FRAME_ALLOC(imRec.width*imRec.height*sizeof(Color));
+
+    for (int i = 0; i < imRec.width*imRec.height; i++) ((Color *)imRec.data)[i] = color;
 
-    Image imRec = GenImageColor((int)rec.width, (int)rec.height, color);
     ImageDraw(dst, imRec, (Rectangle){ 0, 0, rec.width, rec.height }, rec, WHITE);
-    UnloadImage(imRec);
+
+    RL_FRAME_FREE(imRec.data);
 }
 
 // Draw rectangle lines within an image
@@ -2043,8 +2075,8 @@ void ImageFlipVertical(Image *image)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *srcPixels = GetImageData(*image);
-    Color *dstPixels = (Color *)RL_MALLOC(image->width*image->height*sizeof(Color));
+    Color *srcPixels = GetImageDataFrame(*image);
+    Color *dstPixels = (Color *)RL_FRAME_ALLOC(image->width*image->height*sizeof(Color));
 
     for (int y = 0; y < image->height; y++)
     {
@@ -2058,8 +2090,8 @@ void ImageFlipVertical(Image *image)
     ImageFormat(&processed, image->format);
     UnloadImage(*image);
 
-    RL_FREE(srcPixels);
-    RL_FREE(dstPixels);
+    RL_FRAME_FREE(dstPixels);
+    RL_FRAME_FREE(srcPixels);
 
     image->data = processed.data;
 }
@@ -2070,8 +2102,8 @@ void ImageFlipHorizontal(Image *image)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *srcPixels = GetImageData(*image);
-    Color *dstPixels = (Color *)RL_MALLOC(image->width*image->height*sizeof(Color));
+    Color *srcPixels = GetImageDataFrame(*image);
+    Color *dstPixels = (Color *)RL_FRAME_ALLOC(image->width*image->height*sizeof(Color));
 
     for (int y = 0; y < image->height; y++)
     {
@@ -2085,8 +2117,8 @@ void ImageFlipHorizontal(Image *image)
     ImageFormat(&processed, image->format);
     UnloadImage(*image);
 
-    RL_FREE(srcPixels);
-    RL_FREE(dstPixels);
+    RL_FRAME_FREE(dstPixels);
+    RL_FRAME_FREE(srcPixels);
 
     image->data = processed.data;
 }
@@ -2097,8 +2129,8 @@ void ImageRotateCW(Image *image)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *srcPixels = GetImageData(*image);
-    Color *rotPixels = (Color *)RL_MALLOC(image->width*image->height*sizeof(Color));
+    Color *srcPixels = GetImageDataFrame(*image);
+    Color *rotPixels = (Color *)RL_FRAME_ALLOC(image->width*image->height*sizeof(Color));
 
     for (int y = 0; y < image->height; y++)
     {
@@ -2112,8 +2144,8 @@ void ImageRotateCW(Image *image)
     ImageFormat(&processed, image->format);
     UnloadImage(*image);
 
-    RL_FREE(srcPixels);
-    RL_FREE(rotPixels);
+    RL_FRAME_FREE(rotPixels);
+    RL_FRAME_FREE(srcPixels);
 
     image->data = processed.data;
     image->width = processed.width;
@@ -2126,8 +2158,8 @@ void ImageRotateCCW(Image *image)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *srcPixels = GetImageData(*image);
-    Color *rotPixels = (Color *)RL_MALLOC(image->width*image->height*sizeof(Color));
+    Color *srcPixels = GetImageDataFrame(*image);
+    Color *rotPixels = (Color *)RL_FRAME_ALLOC(image->width*image->height*sizeof(Color));
 
     for (int y = 0; y < image->height; y++)
     {
@@ -2141,8 +2173,8 @@ void ImageRotateCCW(Image *image)
     ImageFormat(&processed, image->format);
     UnloadImage(*image);
 
-    RL_FREE(srcPixels);
-    RL_FREE(rotPixels);
+    RL_FRAME_FREE(rotPixels);
+    RL_FRAME_FREE(srcPixels);
 
     image->data = processed.data;
     image->width = processed.width;
@@ -2155,7 +2187,7 @@ void ImageColorTint(Image *image, Color color)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = GetImageData(*image);
+    Color *pixels = GetImageDataFrame(*image);
 
     float cR = (float)color.r/255;
     float cG = (float)color.g/255;
@@ -2182,7 +2214,7 @@ void ImageColorTint(Image *image, Color color)
     Image processed = LoadImageEx(pixels, image->width, image->height);
     ImageFormat(&processed, image->format);
     UnloadImage(*image);
-    RL_FREE(pixels);
+    RL_FRAME_FREE(pixels);
 
     image->data = processed.data;
 }
@@ -2193,7 +2225,7 @@ void ImageColorInvert(Image *image)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = GetImageData(*image);
+    Color *pixels = GetImageDataFrame(*image);
 
     for (int y = 0; y < image->height; y++)
     {
@@ -2208,7 +2240,7 @@ void ImageColorInvert(Image *image)
     Image processed = LoadImageEx(pixels, image->width, image->height);
     ImageFormat(&processed, image->format);
     UnloadImage(*image);
-    RL_FREE(pixels);
+    RL_FRAME_FREE(pixels);
 
     image->data = processed.data;
 }
@@ -2232,7 +2264,7 @@ void ImageColorContrast(Image *image, float contrast)
     contrast = (100.0f + contrast)/100.0f;
     contrast *= contrast;
 
-    Color *pixels = GetImageData(*image);
+    Color *pixels = GetImageDataFrame(*image);
 
     for (int y = 0; y < image->height; y++)
     {
@@ -2271,7 +2303,7 @@ void ImageColorContrast(Image *image, float contrast)
     Image processed = LoadImageEx(pixels, image->width, image->height);
     ImageFormat(&processed, image->format);
     UnloadImage(*image);
-    RL_FREE(pixels);
+    RL_FRAME_FREE(pixels);
 
     image->data = processed.data;
 }
@@ -2286,7 +2318,7 @@ void ImageColorBrightness(Image *image, int brightness)
     if (brightness < -255) brightness = -255;
     if (brightness > 255) brightness = 255;
 
-    Color *pixels = GetImageData(*image);
+    Color *pixels = GetImageDataFrame(*image);
 
     for (int y = 0; y < image->height; y++)
     {
@@ -2314,7 +2346,7 @@ void ImageColorBrightness(Image *image, int brightness)
     Image processed = LoadImageEx(pixels, image->width, image->height);
     ImageFormat(&processed, image->format);
     UnloadImage(*image);
-    RL_FREE(pixels);
+    RL_FRAME_FREE(pixels);
 
     image->data = processed.data;
 }
@@ -2325,7 +2357,7 @@ void ImageColorReplace(Image *image, Color color, Color replace)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = GetImageData(*image);
+    Color *pixels = GetImageDataFrame(*image);
 
     for (int y = 0; y < image->height; y++)
     {
@@ -2347,7 +2379,7 @@ void ImageColorReplace(Image *image, Color color, Color replace)
     Image processed = LoadImageEx(pixels, image->width, image->height);
     ImageFormat(&processed, image->format);
     UnloadImage(*image);
-    RL_FREE(pixels);
+    RL_FRAME_FREE(pixels);
 
     image->data = processed.data;
 }
@@ -2356,13 +2388,13 @@ void ImageColorReplace(Image *image, Color color, Color replace)
 // Generate image: plain color
 Image GenImageColor(int width, int height, Color color)
 {
-    Color *pixels = (Color *)RL_CALLOC(width*height, sizeof(Color));
+    Color *pixels = (Color *)RL_FRAME_ALLOC(width*height*sizeof(Color));
 
     for (int i = 0; i < width*height; i++) pixels[i] = color;
 
     Image image = LoadImageEx(pixels, width, height);
 
-    RL_FREE(pixels);
+    RL_FRAME_FREE(pixels);
 
     return image;
 }
@@ -2972,6 +3004,130 @@ void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle destR
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+// Get pixel data from image in the form of Color struct array, transient frame memory
+// NOTE: Returned data must be freed with RL_FRAME_FREE() before the end of the frame
+static Color *GetImageDataFrame(Image image)
+{
+    if ((image.width == 0) || (image.height == 0)) return NULL;
+
+    Color *pixels = (Color *)RL_FRAME_ALLOC(image.width*image.height*sizeof(Color));
+
+    ReadImagePixels(image, pixels);
+
+    return pixels;
+}
+
+// Read image pixel data into a Color struct array (image.width*image.height)
+static void ReadImagePixels(Image image, Color *pixels)
+{
+    if (image.format >= COMPRESSED_DXT1_RGB) TraceLog(LOG_WARNING, "Pixel data retrieval not supported for compressed image formats");
+    else
+    {
+        if ((image.format == UNCOMPRESSED_R32) ||
+            (image.format == UNCOMPRESSED_R32G32B32) ||
+            (image.format == UNCOMPRESSED_R32G32B32A32)) TraceLog(LOG_WARNING, "32bit pixel format converted to 8bit per channel");
+
+        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        {
+            switch (image.format)
+            {
+                case UNCOMPRESSED_GRAYSCALE:
+                {
+                    pixels[i].r = ((unsigned char *)image.data)[i];
+                    pixels[i].g = ((unsigned char *)image.data)[i];
+                    pixels[i].b = ((unsigned char *)image.data)[i];
+                    pixels[i].a = 255;
+
+                } break;
+                case UNCOMPRESSED_GRAY_ALPHA:
+                {
+                    pixels[i].r = ((unsigned char *)image.data)[k];
+                    pixels[i].g = ((unsigned char *)image.data)[k];
+                    pixels[i].b = ((unsigned char *)image.data)[k];
+                    pixels[i].a = ((unsigned char *)image.data)[k + 1];
+
+                    k += 2;
+                } break;
+                case UNCOMPRESSED_R5G5B5A1:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
+                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
+                    pixels[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
+
+                } break;
+                case UNCOMPRESSED_R5G6B5:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
+                    pixels[i].b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
+                    pixels[i].a = 255;
+
+                } break;
+                case UNCOMPRESSED_R4G4B4A4:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
+                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
+                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
+                    pixels[i].a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
+
+                } break;
+                case UNCOMPRESSED_R8G8B8A8:
+                {
+                    pixels[i].r = ((unsigned char *)image.data)[k];
+                    pixels[i].g = ((unsigned char *)image.data)[k + 1];
+                    pixels[i].b = ((unsigned char *)image.data)[k + 2];
+                    pixels[i].a = ((unsigned char *)image.data)[k + 3];
+
+                    k += 4;
+                } break;
+                case UNCOMPRESSED_R8G8B8:
+                {
+                    pixels[i].r = (unsigned char)((unsigned char *)image.data)[k];
+                    pixels[i].g = (unsigned char)((unsigned char *)image.data)[k + 1];
+                    pixels[i].b = (unsigned char)((unsigned char *)image.data)[k + 2];
+                    pixels[i].a = 255;
+
+                    k += 3;
+                } break;
+                case UNCOMPRESSED_R32:
+                {
+                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
+                    pixels[i].g = 0;
+                    pixels[i].b = 0;
+                    pixels[i].a = 255;
+
+                } break;
+                case UNCOMPRESSED_R32G32B32:
+                {
+                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
+                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
+                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
+                    pixels[i].a = 255;
+
+                    k += 3;
+                } break;
+                case UNCOMPRESSED_R32G32B32A32:
+                {
+                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
+                    pixels[i].g = (unsigned char)(((float *)image.data)[k]*255.0f);
+                    pixels[i].b = (unsigned char)(((float *)image.data)[k]*255.0f);
+                    pixels[i].a = (unsigned char)(((float *)image.data)[k]*255.0f);
+
+                    k += 4;
+                } break;
+                default: break;
+            }
+        }
+    }
+}
+
 #if defined(SUPPORT_FILEFORMAT_GIF)
 // Load animated GIF data
 //  - Image.data buffer includes all frames: [image#0][image#1][image#2][...]
@@ -3005,7 +3161,7 @@ static Image LoadAnimatedGIF(const char *fileName, int *frames, int **delays)
         image.mipmaps = 1;
         image.format = UNCOMPRESSED_R8G8B8A8;
 
-        free(buffer);
+        RL_FREE(buffer);
     }
 
     return image;
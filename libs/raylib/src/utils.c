@@ -8,6 +8,10 @@
 *       Show TraceLog() output messages
 *       NOTE: By default LOG_DEBUG traces not shown
 *
+*   #define SUPPORT_MEMORY_TRACKING
+*       Track all raylib allocations (RL_MALLOC, RL_CALLOC, RL_REALLOC, RL_FREE) by call site,
+*       frame allocations, live and peak memory by module, allocations guard for steady-state frames
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -39,21 +43,71 @@
 
 #include "utils.h"
 
+#define RMEM_IMPLEMENTATION
+#include "rmem.h"                       // Required for: FrameArena, memory pools and objects pools
+
 #if defined(PLATFORM_ANDROID)
     #include <errno.h>                  // Required for: Android error types
     #include <android/log.h>            // Required for: Android log system: __android_log_vprint()
     #include <android/asset_manager.h>  // Required for: Android assets manager: AAsset, AAssetManager_open(), ...
 #endif
 
-#include <stdlib.h>                     // Required for: exit()
+#include <stdlib.h>                     // Required for: exit(), malloc(), realloc(), free(), posix_memalign()
 #include <stdio.h>                      // Required for: printf(), sprintf()
 #include <stdarg.h>                     // Required for: va_list, va_start(), vfprintf(), va_end()
-#include <string.h>                     // Required for: strcpy(), strcat()
+#include <string.h>                     // Required for: strcpy(), strcat(), memset(), memcpy()
+
+#if defined(_WIN32)
+    #include <malloc.h>                 // Required for: _aligned_malloc(), _aligned_realloc(), _aligned_free()
+#endif
 
 #define MAX_TRACELOG_BUFFER_SIZE   128  // Max length of one trace-log message
 
 #define MAX_UWP_MESSAGES 512            // Max UWP messages to process
 
+#define MEM_DEFAULT_ALIGNMENT (2*sizeof(void *))  // Alignment guaranteed by malloc()
+
+#define MAX_MEMORY_SITES 1024           // Max allocation call sites tracked (power of two)
+#define MAX_MEMORY_TOP_SITES 12         // Number of call sites shown by TraceMemoryStats()
+
+#if defined(SUPPORT_FRAME_ARENA)
+    #define FRAME_ARENA_SIZE    (16*1024*1024)  // Frame arena size in bytes, bigger allocations fallback to RL_MALLOC()
+#endif
+
+#if defined(SUPPORT_MEMORY_TRACKING)
+    #if defined(_MSC_VER)
+        #include <intrin.h>             // Required for: _InterlockedExchange()
+        #define MEMORY_LOCK()           while (_InterlockedExchange(&memoryLock, 1)) { }
+        #define MEMORY_UNLOCK()         _InterlockedExchange(&memoryLock, 0)
+    #else
+        #define MEMORY_LOCK()           while (__atomic_exchange_n(&memoryLock, 1, __ATOMIC_ACQUIRE)) { }
+        #define MEMORY_UNLOCK()         __atomic_store_n(&memoryLock, 0, __ATOMIC_RELEASE)
+    #endif
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+#if defined(SUPPORT_MEMORY_TRACKING)
+// Allocation call site
+typedef struct MemorySite {
+    const char *file;                   // Source file (__FILE__), NULL if site slot is empty
+    int line;                           // Source line (__LINE__)
+    int module;                         // Module of source file (MemoryModule)
+    long long allocs;                   // Allocations since program start
+    int liveAllocs;                     // Number of live allocations
+    long long liveBytes;                // Live allocated bytes
+    bool guardReported;                 // Site already reported by allocations guard
+} MemorySite;
+
+// Live allocation, open addressing hash table entry
+typedef struct MemoryBlock {
+    void *ptr;                          // Allocated pointer, NULL if entry is empty
+    size_t size;                        // Allocated size in bytes
+    int site;                           // Call site index
+} MemoryBlock;
+#endif
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -63,6 +117,24 @@ static int logTypeLevel = LOG_INFO;                     // Minimum log type leve
 static int logTypeExit = LOG_ERROR;                     // Log type that exits
 static TraceLogCallback logCallback = NULL;             // Log callback function pointer
 
+static MemAllocator memAllocator = { 0 };               // Memory allocator, NULL callbacks use default allocator
+
+#if defined(SUPPORT_MEMORY_TRACKING)
+static volatile long memoryLock = 0;                    // Memory tracking spin lock (allocations from any thread)
+static MemorySite memorySites[MAX_MEMORY_SITES] = { 0 };// Allocation call sites (hashed by file and line)
+static MemoryBlock *memoryBlocks = NULL;                // Live allocations hash table (by pointer)
+static int memoryBlocksCapacity = 0;                    // Live allocations hash table size (power of two)
+static MemoryStats memoryStats = { 0 };                 // Memory statistics of current frame (and live memory)
+static MemoryStats memoryStatsLast = { 0 };             // Memory statistics of last completed frame
+static bool memoryGuard = false;                        // Report frame allocations call sites
+#endif
+
+#if defined(SUPPORT_FRAME_ARENA)
+static FrameArena frameArena = { 0 };                   // Transient allocations arena, reset every frame
+static THREAD_LOCAL bool frameArenaOwner = false;       // Calling thread owns frame arena (only window thread)
+static int frameArenaFallbacks = 0;                     // Frame allocations that did not fit in arena
+#endif
+
 #if defined(PLATFORM_ANDROID)
 static AAssetManager *assetManager = NULL;              // Android assets manager pointer 
 #endif
@@ -77,6 +149,10 @@ static UWPMessage *UWPInMessages[MAX_UWP_MESSAGES];     // Messages in from UWP
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
+static void *DefaultMemAlloc(void *context, size_t size, size_t alignment);
+static void *DefaultMemRealloc(void *context, void *ptr, size_t size, size_t alignment);
+static void DefaultMemFree(void *context, void *ptr, size_t alignment);
+
 #if defined(PLATFORM_ANDROID)
 // This should be in <stdio.h>, but Travis does not find it...
 FILE *funopen(const void *cookie, int (*readfn)(void *, char *, int), int (*writefn)(void *, const char *, int),
@@ -164,6 +240,534 @@ void TraceLog(int logType, const char *text, ...)
 #endif  // SUPPORT_TRACELOG
 }
 
+// Set memory allocator used by raylib and external libraries
+// NOTE: Memory must be freed by the allocator that allocated it, so allocator should be set
+// before any raylib allocation (InitWindow(), InitAudioDevice(), Load*()...)
+void SetMemAllocator(MemAllocator allocator)
+{
+    if ((allocator.onAlloc == NULL) || (allocator.onRealloc == NULL) || (allocator.onFree == NULL))
+    {
+        if ((allocator.onAlloc != NULL) || (allocator.onRealloc != NULL) || (allocator.onFree != NULL)) TraceLog(LOG_WARNING, "MEMORY: Allocator requires all callbacks, default allocator set");
+
+        memAllocator = (MemAllocator){ 0 };
+    }
+    else memAllocator = allocator;
+}
+
+// Get current memory allocator
+MemAllocator GetMemAllocator(void)
+{
+    if (memAllocator.onAlloc == NULL) return (MemAllocator){ DefaultMemAlloc, DefaultMemRealloc, DefaultMemFree, NULL };
+
+    return memAllocator;
+}
+
+// Allocate memory with current allocator
+void *MemAlloc(size_t size)
+{
+    if (memAllocator.onAlloc == NULL) return DefaultMemAlloc(NULL, size, 0);
+
+    return memAllocator.onAlloc(memAllocator.context, size, 0);
+}
+
+// Allocate aligned memory with current allocator
+// NOTE: Alignment must be a power of two, memory is freed with MemFreeAligned() (same alignment)
+void *MemAllocAligned(size_t size, size_t alignment)
+{
+    if (memAllocator.onAlloc == NULL) return DefaultMemAlloc(NULL, size, alignment);
+
+    return memAllocator.onAlloc(memAllocator.context, size, alignment);
+}
+
+// Allocate zeroed memory with current allocator
+void *MemCalloc(size_t count, size_t size)
+{
+    if ((size > 0) && (count > ((size_t)-1)/size)) return NULL;     // Size overflow
+
+    void *ptr = MemAlloc(count*size);
+    if (ptr != NULL) memset(ptr, 0, count*size);
+
+    return ptr;
+}
+
+// Reallocate memory with current allocator
+// NOTE: Reallocation to size 0 frees memory and returns NULL
+void *MemRealloc(void *ptr, size_t size)
+{
+    if (size == 0)
+    {
+        MemFree(ptr);
+        return NULL;
+    }
+
+    if (memAllocator.onRealloc == NULL) return DefaultMemRealloc(NULL, ptr, size, 0);
+
+    return memAllocator.onRealloc(memAllocator.context, ptr, size, 0);
+}
+
+// Free memory allocated with current allocator
+void MemFree(void *ptr)
+{
+    if (ptr == NULL) return;
+
+    if (memAllocator.onFree == NULL) DefaultMemFree(NULL, ptr, 0);
+    else memAllocator.onFree(memAllocator.context, ptr, 0);
+}
+
+// Free memory allocated with MemAllocAligned(), alignment must be the same used on allocation
+void MemFreeAligned(void *ptr, size_t alignment)
+{
+    if (ptr == NULL) return;
+
+    if (memAllocator.onFree == NULL) DefaultMemFree(NULL, ptr, alignment);
+    else memAllocator.onFree(memAllocator.context, ptr, alignment);
+}
+
+#if defined(SUPPORT_MEMORY_TRACKING)
+// Get module of allocation source file
+static int GetMemoryModule(const char *file)
+{
+    static const struct { const char *name; int module; } modules[] = {
+        { "core.c", MEMORY_CORE }, { "utils.c", MEMORY_CORE }, { "rtrace.h", MEMORY_CORE }, { "rgif.h", MEMORY_CORE },
+        { "rlgl.h", MEMORY_RLGL },
+        { "text.c", MEMORY_TEXT }, { "stb_truetype.h", MEMORY_TEXT }, { "stb_rect_pack.h", MEMORY_TEXT },
+        { "textures.c", MEMORY_TEXTURES }, { "stb_image", MEMORY_TEXTURES },
+        { "raudio.c", MEMORY_RAUDIO }, { "miniaudio.h", MEMORY_RAUDIO }, { "stb_vorbis", MEMORY_RAUDIO },
+        { "dr_", MEMORY_RAUDIO }, { "jar_", MEMORY_RAUDIO },
+        { "models.c", MEMORY_MODELS }, { "cgltf.h", MEMORY_MODELS }, { "tinyobj", MEMORY_MODELS }, { "par_shapes.h", MEMORY_MODELS }
+    };
+
+    for (int i = 0; i < (int)(sizeof(modules)/sizeof(modules[0])); i++)
+    {
+        if (strstr(file, modules[i].name) != NULL) return modules[i].module;
+    }
+
+    return MEMORY_OTHER;
+}
+
+// Get call site index, new sites are registered (-1 if sites table is full)
+// NOTE: Expected to be called with memory lock taken
+static int GetMemorySite(const char *file, int line)
+{
+    unsigned int hash = (unsigned int)line;
+    for (const char *c = file; *c != '\0'; c++) hash = hash*31 + (unsigned char)*c;
+    hash *= 2654435761u;
+
+    for (int i = 0; i < MAX_MEMORY_SITES; i++)
+    {
+        int index = (hash + i)&(MAX_MEMORY_SITES - 1);
+        MemorySite *site = &memorySites[index];
+
+        // NOTE: Same file name can have different pointers on different modules, strings are compared if required
+        if (site->file == NULL)
+        {
+            site->file = file;
+            site->line = line;
+            site->module = GetMemoryModule(file);
+            return index;
+        }
+        else if ((site->line == line) && ((site->file == file) || (strcmp(site->file, file) == 0))) return index;
+    }
+
+    return -1;
+}
+
+// Get live allocation entry for a pointer (empty entry where it should be inserted if not found)
+// NOTE: Expected to be called with memory lock taken, with a non-full table
+static MemoryBlock *GetMemoryBlock(void *ptr)
+{
+    size_t hash = ((size_t)ptr >> 4)*2654435761u;
+
+    for (int i = 0; ; i++)
+    {
+        MemoryBlock *block = &memoryBlocks[(hash + i)&(memoryBlocksCapacity - 1)];
+        if ((block->ptr == ptr) || (block->ptr == NULL)) return block;
+    }
+}
+
+// Remove live allocation entry, following entries of the probe sequence are moved back
+// NOTE: Expected to be called with memory lock taken
+static void RemoveMemoryBlock(MemoryBlock *block)
+{
+    int index = (int)(block - memoryBlocks);
+    block->ptr = NULL;
+
+    for (int i = (index + 1)&(memoryBlocksCapacity - 1); memoryBlocks[i].ptr != NULL; i = (i + 1)&(memoryBlocksCapacity - 1))
+    {
+        MemoryBlock moved = memoryBlocks[i];
+        memoryBlocks[i].ptr = NULL;
+        *GetMemoryBlock(moved.ptr) = moved;
+    }
+}
+
+// Register a new allocation, guard reported call site is returned (-1 if not reported)
+// NOTE: Expected to be called with memory lock taken
+static int AddMemoryBlock(void *ptr, size_t size, const char *file, int line)
+{
+    // Grow live allocations table at 50% load (tables use raw allocator, they are not tracked)
+    if ((memoryStats.liveAllocs + 1)*2 > memoryBlocksCapacity)
+    {
+        MemoryBlock *blocks = memoryBlocks;
+        int capacity = memoryBlocksCapacity;
+
+        memoryBlocksCapacity = (capacity == 0)? 4096 : capacity*2;
+        memoryBlocks = (MemoryBlock *)calloc(memoryBlocksCapacity, sizeof(MemoryBlock));
+
+        for (int i = 0; i < capacity; i++) if (blocks[i].ptr != NULL) *GetMemoryBlock(blocks[i].ptr) = blocks[i];
+
+        free(blocks);
+    }
+
+    int index = GetMemorySite(file, line);
+    int module = (index >= 0)? memorySites[index].module : MEMORY_OTHER;
+    int reported = -1;
+
+    // NOTE: A pointer not freed through RL_FREE() could be returned again by the allocator, it replaces the stale entry
+    MemoryBlock *block = GetMemoryBlock(ptr);
+    if (block->ptr == NULL) memoryStats.liveAllocs++;
+    else
+    {
+        memoryStats.liveBytes -= block->size;
+        if (block->site >= 0)
+        {
+            memorySites[block->site].liveAllocs--;
+            memorySites[block->site].liveBytes -= block->size;
+            memoryStats.moduleLiveBytes[memorySites[block->site].module] -= block->size;
+        }
+        else memoryStats.moduleLiveBytes[MEMORY_OTHER] -= block->size;
+    }
+
+    block->ptr = ptr;
+    block->size = size;
+    block->site = index;
+
+    memoryStats.frameAllocs++;
+    memoryStats.frameBytes += size;
+    memoryStats.totalAllocs++;
+    memoryStats.liveBytes += size;
+    if (memoryStats.liveBytes > memoryStats.peakBytes) memoryStats.peakBytes = memoryStats.liveBytes;
+    memoryStats.moduleFrameAllocs[module]++;
+    memoryStats.moduleLiveBytes[module] += size;
+
+    if (index >= 0)
+    {
+        MemorySite *site = &memorySites[index];
+        site->allocs++;
+        site->liveAllocs++;
+        site->liveBytes += size;
+
+        if (memoryGuard && !site->guardReported)
+        {
+            site->guardReported = true;
+            reported = index;
+        }
+    }
+
+    return reported;
+}
+
+// Unregister a live allocation, untracked pointers are ignored
+// NOTE: Expected to be called with memory lock taken
+static void RemoveMemoryAlloc(void *ptr)
+{
+    if (memoryBlocksCapacity == 0) return;
+
+    MemoryBlock *block = GetMemoryBlock(ptr);
+    if (block->ptr == NULL) return;
+
+    memoryStats.frameFrees++;
+    memoryStats.liveAllocs--;
+    memoryStats.liveBytes -= block->size;
+
+    if (block->site >= 0)
+    {
+        memorySites[block->site].liveAllocs--;
+        memorySites[block->site].liveBytes -= block->size;
+        memoryStats.moduleLiveBytes[memorySites[block->site].module] -= block->size;
+    }
+    else memoryStats.moduleLiveBytes[MEMORY_OTHER] -= block->size;
+
+    RemoveMemoryBlock(block);
+}
+
+// Get call site file name without path (build systems usually provide full paths)
+static const char *GetMemorySiteFileName(const char *file)
+{
+    const char *name = file;
+
+    for (const char *c = file; *c != '\0'; c++) if ((*c == '/') || (*c == '\\')) name = c + 1;
+
+    return name;
+}
+
+// Report call site allocating in a guarded frame
+static void ReportMemoryGuard(int index, size_t size)
+{
+    if (index >= 0) TraceLog(LOG_WARNING, "MEMORY: Frame allocation guard: %i bytes allocated at %s:%i", (int)size, GetMemorySiteFileName(memorySites[index].file), memorySites[index].line);
+}
+
+// Allocate memory, tracked by call site
+void *MemTrackAlloc(size_t size, const char *file, int line)
+{
+    void *ptr = MemAlloc(size);
+    if (ptr == NULL) return NULL;
+
+    MEMORY_LOCK();
+    int reported = AddMemoryBlock(ptr, size, file, line);
+    MEMORY_UNLOCK();
+
+    ReportMemoryGuard(reported, size);
+
+    return ptr;
+}
+
+// Allocate zeroed memory, tracked by call site
+void *MemTrackCalloc(size_t count, size_t size, const char *file, int line)
+{
+    void *ptr = MemCalloc(count, size);
+    if (ptr == NULL) return NULL;
+
+    MEMORY_LOCK();
+    int reported = AddMemoryBlock(ptr, count*size, file, line);
+    MEMORY_UNLOCK();
+
+    ReportMemoryGuard(reported, count*size);
+
+    return ptr;
+}
+
+// Reallocate memory, tracked by call site
+// NOTE: Reallocation is registered as a free and a new allocation on new call site
+void *MemTrackRealloc(void *ptr, size_t size, const char *file, int line)
+{
+    int reported = -1;
+
+    // NOTE: Reallocation is done with lock taken, so freed pointer can not be returned to other thread before unregistered
+    MEMORY_LOCK();
+    size_t address = (size_t)ptr;           // Previous allocation key, pointer is not valid after realloc()
+    void *result = MemRealloc(ptr, size);
+
+    if ((result != NULL) || (size == 0))    // On failure original pointer is still valid
+    {
+        if (address != 0) RemoveMemoryAlloc((void *)address);
+        if (result != NULL) reported = AddMemoryBlock(result, size, file, line);
+    }
+    MEMORY_UNLOCK();
+
+    ReportMemoryGuard(reported, size);
+
+    return result;
+}
+
+// Free memory, untracked pointers are just freed
+void MemTrackFree(void *ptr)
+{
+    if (ptr == NULL) return;
+
+    MEMORY_LOCK();
+    RemoveMemoryAlloc(ptr);
+    MEMORY_UNLOCK();
+
+    MemFree(ptr);
+}
+#endif  // SUPPORT_MEMORY_TRACKING
+
+// Close current frame memory statistics and start a new frame
+// NOTE: Called by EndDrawing(), so a frame covers update and drawing
+void UpdateMemoryStats(void)
+{
+#if defined(SUPPORT_MEMORY_TRACKING)
+    MEMORY_LOCK();
+
+    memoryStatsLast = memoryStats;
+
+    memoryStats.frameAllocs = 0;
+    memoryStats.frameFrees = 0;
+    memoryStats.frameBytes = 0;
+    for (int i = 0; i < MAX_MEMORY_MODULES; i++) memoryStats.moduleFrameAllocs[i] = 0;
+
+    MEMORY_UNLOCK();
+#endif
+}
+
+// Get memory allocations statistics
+// NOTE: Frame values refer to last completed frame, live memory values are current
+MemoryStats GetMemoryStats(void)
+{
+    MemoryStats stats = { 0 };
+
+#if defined(SUPPORT_MEMORY_TRACKING)
+    MEMORY_LOCK();
+
+    stats = memoryStatsLast;
+    stats.liveAllocs = memoryStats.liveAllocs;
+    stats.liveBytes = memoryStats.liveBytes;
+    stats.peakBytes = memoryStats.peakBytes;
+    stats.totalAllocs = memoryStats.totalAllocs;
+    for (int i = 0; i < MAX_MEMORY_MODULES; i++) stats.moduleLiveBytes[i] = memoryStats.moduleLiveBytes[i];
+
+    MEMORY_UNLOCK();
+#endif
+
+    return stats;
+}
+
+// Set allocations guard, any allocation while enabled is reported (once by call site)
+// NOTE: Useful to check steady-state frames do not allocate, enable it after loading
+void SetMemoryFrameGuard(bool enabled)
+{
+#if defined(SUPPORT_MEMORY_TRACKING)
+    MEMORY_LOCK();
+    memoryGuard = enabled;
+    for (int i = 0; i < MAX_MEMORY_SITES; i++) memorySites[i].guardReported = false;
+    MEMORY_UNLOCK();
+#else
+    TraceLog(LOG_WARNING, "MEMORY: Allocations guard requires SUPPORT_MEMORY_TRACKING");
+#endif
+}
+
+// Show memory statistics by module and top allocation call sites
+// NOTE: On program exit live allocations are usually leaks, live values are shown by call site
+void TraceMemoryStats(void)
+{
+#if defined(SUPPORT_MEMORY_TRACKING)
+    static const char *moduleNames[MAX_MEMORY_MODULES] = { "core", "rlgl", "text", "textures", "raudio", "models", "other" };
+
+    MemoryStats stats = GetMemoryStats();
+    int top[MAX_MEMORY_TOP_SITES] = { 0 };
+    int topCount = 0;
+
+    MEMORY_LOCK();
+
+    // Select call sites with more allocations (insertion into sorted top list)
+    for (int i = 0; i < MAX_MEMORY_SITES; i++)
+    {
+        if (memorySites[i].file == NULL) continue;
+
+        int k = topCount;
+        while ((k > 0) && (memorySites[top[k - 1]].allocs < memorySites[i].allocs)) k--;
+        if (k >= MAX_MEMORY_TOP_SITES) continue;
+
+        if (topCount < MAX_MEMORY_TOP_SITES) topCount++;
+        for (int j = topCount - 1; j > k; j--) top[j] = top[j - 1];
+        top[k] = i;
+    }
+
+    MemorySite sites[MAX_MEMORY_TOP_SITES] = { 0 };
+    for (int i = 0; i < topCount; i++) sites[i] = memorySites[top[i]];
+
+    MEMORY_UNLOCK();
+
+    TraceLog(LOG_INFO, "MEMORY: Live: %i allocations, %lld bytes | Peak: %lld bytes | Total: %lld allocations",
+             stats.liveAllocs, stats.liveBytes, stats.peakBytes, stats.totalAllocs);
+
+    for (int i = 0; i < MAX_MEMORY_MODULES; i++)
+    {
+        TraceLog(LOG_INFO, "MEMORY:   %-8s live %10lld bytes, last frame %i allocations", moduleNames[i], stats.moduleLiveBytes[i], stats.moduleFrameAllocs[i]);
+    }
+
+    for (int i = 0; i < topCount; i++)
+    {
+        TraceLog(LOG_INFO, "MEMORY:   %s:%i [%s] %lld allocations, live %i (%lld bytes)", GetMemorySiteFileName(sites[i].file), sites[i].line,
+                 moduleNames[sites[i].module], sites[i].allocs, sites[i].liveAllocs, sites[i].liveBytes);
+    }
+#endif
+}
+
+#if defined(SUPPORT_FRAME_ARENA)
+// Create frame arena, used by calling thread only
+// NOTE: Allocations from other threads (i.e. loading threads) fallback to RL_MALLOC()
+void InitFrameArena(void)
+{
+    if (frameArena.stack.mem != NULL) return;
+
+    // NOTE: Arena buffer is requested to current allocator, cache line aligned
+    void *buffer = MemAllocAligned(FRAME_ARENA_SIZE, 64);
+    frameArena = CreateFrameArenaFromBuffer(buffer, FRAME_ARENA_SIZE);
+    if (frameArena.stack.mem == NULL) MemFreeAligned(buffer, 64);
+    frameArenaFallbacks = 0;
+
+    if (frameArena.stack.mem != NULL)
+    {
+        frameArenaOwner = true;
+        TraceLog(LOG_INFO, "MEMORY: Frame arena created successfully (%i KB)", FRAME_ARENA_SIZE/1024);
+    }
+    else TraceLog(LOG_WARNING, "MEMORY: Frame arena could not be created, using heap memory");
+}
+
+// Destroy frame arena
+void CloseFrameArena(void)
+{
+    if (frameArena.stack.mem == NULL) return;
+
+    TraceLog(LOG_INFO, "MEMORY: Frame arena peak usage: %i KB, heap fallbacks: %i", (int)(frameArena.peak/1024), frameArenaFallbacks);
+
+    MemFreeAligned(frameArena.stack.mem, 64);
+    frameArena = (FrameArena){ 0 };
+    frameArenaOwner = false;
+}
+
+// Release all frame allocations
+void ResetFrameArena(void)
+{
+    if (frameArenaOwner) FrameArenaReset(&frameArena);
+}
+
+// Allocate frame memory, fallback to RL_MALLOC() if arena is full
+void *MemFrameAlloc(size_t size)
+{
+    void *ptr = NULL;
+
+    if (frameArenaOwner) ptr = FrameArenaAlloc(&frameArena, size);
+
+    if (ptr == NULL)
+    {
+        if (frameArenaOwner) frameArenaFallbacks++;
+        ptr = RL_MALLOC(size);
+    }
+
+    return ptr;
+}
+
+// Allocate frame memory without heap fallback
+// NOTE: Returns NULL if arena is full or not owned by calling thread, memory is released on ResetFrameArena()
+void *MemFrameTryAlloc(size_t size)
+{
+    if (!frameArenaOwner) return NULL;
+
+    return FrameArenaAlloc(&frameArena, size);
+}
+
+// Allocate zeroed frame memory, fallback to RL_CALLOC() if arena is full
+void *MemFrameCalloc(size_t count, size_t size)
+{
+    void *ptr = NULL;
+
+    if (frameArenaOwner)
+    {
+        ptr = FrameArenaAlloc(&frameArena, count*size);
+        if (ptr != NULL) memset(ptr, 0, count*size);
+    }
+
+    if (ptr == NULL)
+    {
+        if (frameArenaOwner) frameArenaFallbacks++;
+        ptr = RL_CALLOC(count, size);
+    }
+
+    return ptr;
+}
+
+// Free frame memory, last allocation is reclaimed
+// NOTE: Pointers out of the arena are heap fallbacks
+void MemFrameFree(void *ptr)
+{
+    if (ptr == NULL) return;
+
+    if (!frameArenaOwner || !FrameArenaFree(&frameArena, ptr)) RL_FREE(ptr);
+}
+#endif  // SUPPORT_FRAME_ARENA
+
 #if defined(PLATFORM_ANDROID)
 // Initialize asset manager from android app
 void InitAssetManager(AAssetManager *manager)
@@ -187,6 +791,64 @@ FILE *android_fopen(const char *fileName, const char *mode)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+// Allocate memory, default allocator (C runtime heap)
+// NOTE: Default alignment uses malloc(), so raylib returned buffers can be released with free(),
+// bigger alignments use _aligned_malloc() on Windows (released with _aligned_free())
+static void *DefaultMemAlloc(void *context, size_t size, size_t alignment)
+{
+    (void)context;
+
+    if (alignment <= MEM_DEFAULT_ALIGNMENT) return malloc(size);
+
+#if defined(_WIN32)
+    return _aligned_malloc(size, alignment);
+#else
+    void *ptr = NULL;
+    if (posix_memalign(&ptr, alignment, size) != 0) return NULL;
+
+    return ptr;
+#endif
+}
+
+// Reallocate memory, default allocator (C runtime heap)
+static void *DefaultMemRealloc(void *context, void *ptr, size_t size, size_t alignment)
+{
+#if defined(_WIN32)
+    (void)context;
+    if (alignment <= MEM_DEFAULT_ALIGNMENT) return realloc(ptr, size);
+
+    return _aligned_realloc(ptr, size, alignment);
+#else
+    void *result = realloc(ptr, size);
+
+    // NOTE: realloc() only keeps malloc() alignment, bigger alignments require a new allocation
+    if ((result != NULL) && (alignment > MEM_DEFAULT_ALIGNMENT) && (((size_t)result & (alignment - 1)) != 0))
+    {
+        void *aligned = DefaultMemAlloc(context, size, alignment);
+        if (aligned != NULL) memcpy(aligned, result, size);
+
+        free(result);
+        result = aligned;
+    }
+
+    return result;
+#endif
+}
+
+// Free memory, default allocator (C runtime heap)
+static void DefaultMemFree(void *context, void *ptr, size_t alignment)
+{
+    (void)context;
+
+#if defined(_WIN32)
+    if (alignment > MEM_DEFAULT_ALIGNMENT) _aligned_free(ptr);
+    else free(ptr);
+#else
+    (void)alignment;
+    free(ptr);
+#endif
+}
+
 #if defined(PLATFORM_ANDROID)
 static int android_read(void *cookie, char *buf, int size)
 {
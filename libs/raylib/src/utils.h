@@ -32,6 +32,8 @@
     #include <android/asset_manager.h>      // Required for: AAssetManager
 #endif
 
+#include <stddef.h>                         // Required for: size_t
+
 //----------------------------------------------------------------------------------
 // Some basic Defines
 //----------------------------------------------------------------------------------
@@ -39,6 +41,39 @@
     #define fopen(name, mode) android_fopen(name, mode)
 #endif
 
+#if defined(SUPPORT_MEMORY_TRACKING)
+    // Redirect raylib allocations to tracking functions, call site (file and line) is recorded
+    // NOTE: Modules include utils.h after raylib.h, so default (or custom) allocators are replaced
+    #undef RL_MALLOC
+    #undef RL_CALLOC
+    #undef RL_REALLOC
+    #undef RL_FREE
+
+    #define RL_MALLOC(sz)       MemTrackAlloc(sz, __FILE__, __LINE__)
+    #define RL_CALLOC(n,sz)     MemTrackCalloc(n, sz, __FILE__, __LINE__)
+    #define RL_REALLOC(p,sz)    MemTrackRealloc(p, sz, __FILE__, __LINE__)
+    #define RL_FREE(p)          MemTrackFree(p)
+#endif
+
+// Thread local storage
+#if defined(_MSC_VER)
+    #define THREAD_LOCAL    __declspec(thread)
+#else
+    #define THREAD_LOCAL    __thread
+#endif
+
+// Transient allocations, memory must be freed before the end of the frame (EndDrawing())
+// NOTE: Frame memory should not be reallocated or returned to the user, RL_FRAME_FREE() must be used
+#if defined(SUPPORT_FRAME_ARENA)
+    #define RL_FRAME_ALLOC(sz)      MemFrameAlloc(sz)
+    #define RL_FRAME_CALLOC(n,sz)   MemFrameCalloc(n, sz)
+    #define RL_FRAME_FREE(p)        MemFrameFree(p)
+#else
+    #define RL_FRAME_ALLOC(sz)      RL_MALLOC(sz)
+    #define RL_FRAME_CALLOC(n,sz)   RL_CALLOC(n,sz)
+    #define RL_FRAME_FREE(p)        RL_FREE(p)
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -54,6 +89,24 @@ extern "C" {            // Prevents name mangling of functions
 //----------------------------------------------------------------------------------
 // Module Functions Declaration
 //----------------------------------------------------------------------------------
+#if defined(SUPPORT_MEMORY_TRACKING)
+void *MemTrackAlloc(size_t size, const char *file, int line);              // Allocate memory, tracked by call site
+void *MemTrackCalloc(size_t count, size_t size, const char *file, int line); // Allocate zeroed memory, tracked by call site
+void *MemTrackRealloc(void *ptr, size_t size, const char *file, int line); // Reallocate memory, tracked by call site
+void MemTrackFree(void *ptr);                                              // Free memory, untracked pointers are just freed
+#endif
+void UpdateMemoryStats(void);                   // Close current frame memory statistics (called by EndDrawing())
+
+#if defined(SUPPORT_FRAME_ARENA)
+void InitFrameArena(void);                      // Create frame arena, used by calling thread only (called by InitWindow())
+void CloseFrameArena(void);                     // Destroy frame arena (called by CloseWindow())
+void ResetFrameArena(void);                     // Release all frame allocations (called by EndDrawing())
+void *MemFrameAlloc(size_t size);               // Allocate frame memory, fallback to RL_MALLOC() if arena is full
+void *MemFrameCalloc(size_t count, size_t size); // Allocate zeroed frame memory, fallback to RL_CALLOC() if arena is full
+void *MemFrameTryAlloc(size_t size);            // Allocate frame memory, NULL if arena is full or not owned (no heap fallback)
+void MemFrameFree(void *ptr);                   // Free frame memory, last allocation is reclaimed
+#endif
+
 #if defined(PLATFORM_ANDROID)
 void InitAssetManager(AAssetManager *manager);  // Initialize asset manager from android app
 FILE *android_fopen(const char *fileName, const char *mode);    // Replacement for fopen()
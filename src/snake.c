@@ -0,0 +1,483 @@
+#include "snake.h"
+#define RTILEMAP_IMPLEMENTATION
+#include "rtilemap.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+Letter letter1, letter2;
+
+/* ------------------------- INIT ------------------------- */
+
+// the snake's initial spawn location is in the middle of the map, and its direction to the right
+void InitSnake(Snake *snake, GameState *gameState) {
+    snake->length = SNAKE_INITIAL_LENGTH;
+    snake->body = (Vector2 *)malloc(SNAKE_INITIAL_LENGTH * sizeof(Vector2));
+    snake->body[0] = (Vector2){gameState->mapWidth / 2, gameState->mapHeight / 2};
+    snake->direction = (Vector2){1, 0};
+}
+
+void InitBooster(Booster *booster, int type, GameState *gameState) {
+    booster->position.x = rand() % (gameState->mapWidth - 2) + 1;
+    booster->position.y = rand() % (gameState->mapHeight - 2) + 1;
+    booster->isActive = true;
+    booster->type = type;
+}
+
+void MoveSnake(Snake *snake) {
+    for (int i = snake->length - 1; i > 0; i--) {
+        snake->body[i] = snake->body[i - 1];
+    }
+
+    snake->body[0].x += snake->direction.x;
+    snake->body[0].y += snake->direction.y;
+}
+
+// Initialize the word for the current game
+void InitWordGame(GameState *gameState) {
+    int randomIndex = rand() % (sizeof(gameState->wordList)/sizeof(gameState->wordList[0]));
+    strcpy(gameState->currentWord, gameState->wordList[randomIndex]);
+    gameState->currentWordLength = strlen(gameState->currentWord);
+    for (int i = 0; i < gameState->currentWordLength; i++) {
+        gameState->guessedWord[i] = '_';
+    }
+    gameState->guessedWord[gameState->currentWordLength] = '\0';
+}
+
+// Generate two random letters: one correct and one incorrect
+void GenerateLetterChoices(GameState *gameState) {
+    // letter 1 : contained in the word
+    char correctLetter;
+    int found = 0;
+    for (int i = 0; i < gameState->currentWordLength; i++) {
+        if (gameState->guessedWord[i] == '_') {
+            correctLetter = gameState->currentWord[i];
+            found = 1;
+            break;
+        }
+    }
+
+    if (!found) {
+        return;
+    }
+
+    gameState->letterChoices[0] = correctLetter;
+
+    // letter 2: not contained in word
+    do {
+        gameState->letterChoices[1] = 'a' + (rand() % 26);
+    } while (strchr(gameState->currentWord, gameState->letterChoices[1])); // Ensure it’s not in the word
+
+    if (rand() % 2 == 0) {
+        char temp = gameState->letterChoices[0];
+        gameState->letterChoices[0] = gameState->letterChoices[1];
+        gameState->letterChoices[1] = temp;
+    }
+
+    letter1.position = (Vector2){rand() % (gameState->mapWidth - 2) + 1, rand() % (gameState->mapHeight - 2) + 1};
+    letter2.position = (Vector2){rand() % (gameState->mapWidth - 2) + 1, rand() % (gameState->mapHeight - 2) + 1};
+    letter1.value = gameState->letterChoices[0];
+    letter2.value = gameState->letterChoices[1];
+}
+
+/* ------------------------- COLLISIONS HANDLING (wall/snake, letter/booster) -------------------------*/
+
+int CheckCollision(Snake *snake, GameState *gameState) {
+    // collision with wall
+    if (snake->body[0].x < 1 || snake->body[0].x >= gameState->mapWidth - 1 || 
+        snake->body[0].y < 1 || snake->body[0].y >= gameState->mapHeight - 1) {
+        return 1;
+    }
+
+    //collision with snake
+    for (int i = 1; i < snake->length; i++) {
+        if (snake->body[0].x == snake->body[i].x && snake->body[0].y == snake->body[i].y) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int CheckLetterCollision(Snake *snake, Letter *letter) {
+    return (snake->body[0].x == letter->position.x && snake->body[0].y == letter->position.y);
+}
+
+int CheckBoosterCollision(Snake *snake, Booster *booster, Sound boosterSound) {
+    if (booster->isActive && snake->body[0].x == booster->position.x && snake->body[0].y == booster->position.y) {
+        booster->isActive = false;
+        PlaySound(boosterSound);
+        return 1;
+    }
+    return 0;
+}
+
+/* ------------------------- GAME LOGIC -------------------------*/
+
+void HandleLetterCollision(Snake *snake, GameState *gameState, Letter *letter, Sound eatSound) {
+    char chosenLetter = letter->value;
+
+    // check if the eaten letter is in the word
+    int found = 0;
+    for (int i = 0; i < gameState->currentWordLength; i++) {
+        if (gameState->currentWord[i] == chosenLetter && gameState->guessedWord[i] == '_') {
+            gameState->guessedWord[i] = chosenLetter; // Update guessed word
+            found = 1;
+        }
+    }
+
+    // if the letter is incorrect or already guessed
+    if (!found) {
+        gameState->extraLives--;
+        if (gameState->extraLives < 0) {
+            gameState->extraLives = 0;
+        }
+    } else {
+        PlaySound(eatSound);
+    }
+
+    snake->length += 1; 
+    snake->body = (Vector2 *)realloc(snake->body, snake->length * sizeof(Vector2));
+    snake->body[snake->length - 1] = snake->body[snake->length - 2]; // the new segment follows the tail on next move
+
+    GenerateLetterChoices(gameState);
+}
+
+void HandleSizeReducer(Snake *snake) {
+    if (snake->length > 1) {
+        snake->length -= 2; // reduce size by 2
+        if (snake->length < 1) { // make sure the snake is always at least 1 square long
+            snake->length = 1;
+        }
+        snake->body = (Vector2 *)realloc(snake->body, snake->length * sizeof(Vector2));
+    }
+}
+
+void HandleCollision(Snake *snake, GameState *gameState, bool *isGameRunning) {
+    if (CheckCollision(snake, gameState)) {
+        if (gameState->extraLives > 0) {
+            gameState->extraLives--;
+
+            // Reset snake size to 1 and place it at the center of the map (like at the start)
+            snake->length = 1;
+            free(snake->body);
+            snake->body = (Vector2 *)malloc(sizeof(Vector2));
+            snake->body[0] = (Vector2){gameState->mapWidth / 2, gameState->mapHeight / 2};  
+            
+            snake->direction = (Vector2){1, 0}; // initially moving to the right
+        } else {
+            *isGameRunning = false;  // end game if no extra lives
+        }
+    }
+}
+
+void RestartGame(Snake *snake, GameState *gameState, int *currentWordLength, bool *isGameRunning) {
+    free(snake->body);
+    snake->length = SNAKE_INITIAL_LENGTH;
+    snake->body = (Vector2 *)malloc(snake->length * sizeof(Vector2));
+    snake->body[0] = (Vector2){gameState->mapWidth / 2, gameState->mapHeight / 2};
+    snake->direction = (Vector2){1, 0};
+
+    InitWordGame(gameState);
+    GenerateLetterChoices(gameState);
+    *currentWordLength = 0;
+    *isGameRunning = true;
+}
+
+/* ------------------------- DRAWING ELEMENTS -------------------------*/
+
+// the board cells (walls, snake, booster, letters) are painted into a staging array of cell states every frame,
+// then handed to the board renderer: only cells whose state changed are re-uploaded to the GPU
+void PaintCell(unsigned char *board, GameState *gameState, Vector2 position, unsigned char state) {
+    int x = (int)position.x;
+    int y = (int)position.y;
+    if (x >= 0 && x < gameState->mapWidth && y >= 0 && y < gameState->mapHeight) {
+        board[y * gameState->mapWidth + x] = state;
+    }
+}
+
+// empty = transparent, walls = white, snake = green, letters = red
+// speed = yellow, size reduce = purple, blue = extra life
+Color GetCellColor(unsigned char state) {
+    switch (state) {
+        case CELL_WALL: return RAYWHITE;
+        case CELL_SNAKE: return GREEN;
+        case CELL_LETTER: return RED;
+        case CELL_BOOSTER_SPEED: return YELLOW;
+        case CELL_BOOSTER_SIZE: return PURPLE;
+        case CELL_BOOSTER_LIFE: return BLUE;
+        default: return BLANK;
+    }
+}
+
+void DrawSnake(unsigned char *board, GameState *gameState, Snake *snake) {
+    for (int i = 0; i < snake->length; i++) {
+        PaintCell(board, gameState, snake->body[i], CELL_SNAKE);
+    }
+}
+
+void DrawWalls(unsigned char *board, GameState *gameState) {
+    for (int x = 0; x < gameState->mapWidth; x++) {
+        PaintCell(board, gameState, (Vector2){x, 0}, CELL_WALL);
+        PaintCell(board, gameState, (Vector2){x, gameState->mapHeight - 1}, CELL_WALL);
+    }
+    for (int y = 0; y < gameState->mapHeight; y++) {
+        PaintCell(board, gameState, (Vector2){0, y}, CELL_WALL);
+        PaintCell(board, gameState, (Vector2){gameState->mapWidth - 1, y}, CELL_WALL);
+    }
+}
+
+void DrawBooster(unsigned char *board, GameState *gameState, Booster *booster) {
+    if (booster->isActive) {
+        PaintCell(board, gameState, booster->position, CELL_BOOSTER_SPEED + booster->type);
+    }
+}
+
+// the letters text is drawn on top of the board in DrawLetters()
+void DrawLetterCells(unsigned char *board, GameState *gameState, Letter *letter1, Letter *letter2) {
+    PaintCell(board, gameState, letter1->position, CELL_LETTER);
+    PaintCell(board, gameState, letter2->position, CELL_LETTER);
+}
+
+// copy the staging board into the tile map and draw it below the HUD
+void DrawBoard(TileMap *tileMap, unsigned char *board, GameState *gameState) {
+    for (int y = 0; y < gameState->mapHeight; y++) {
+        for (int x = 0; x < gameState->mapWidth; x++) {
+            SetTileMapCell(tileMap, x, y, GetCellColor(board[y * gameState->mapWidth + x]));
+        }
+    }
+    DrawTileMap(tileMap, (Vector2){0, VERTICAL_OFFSET});
+}
+
+/* ------------------------- PERSISTENT BOARD ------------------------- */
+
+static bool SameCell(Vector2 a, Vector2 b) {
+    return a.x == b.x && a.y == b.y;
+}
+
+static bool IsSnakeCell(Snake *snake, Vector2 position) {
+    for (int i = 0; i < snake->length; i++) {
+        if (SameCell(snake->body[i], position)) return true;
+    }
+    return false;
+}
+
+// same state than the staging painting order: walls, snake, letters, booster (last painted wins)
+static unsigned char GetBoardCellState(GameState *gameState, Snake *snake, Booster *booster, Vector2 position) {
+    if (booster->isActive && SameCell(booster->position, position)) return CELL_BOOSTER_SPEED + booster->type;
+    if (SameCell(letter1.position, position) || SameCell(letter2.position, position)) return CELL_LETTER;
+    if (IsSnakeCell(snake, position)) return CELL_SNAKE;
+    if (position.x == 0 || position.y == 0 || position.x == gameState->mapWidth - 1 || position.y == gameState->mapHeight - 1) return CELL_WALL;
+    return CELL_EMPTY;
+}
+
+// recompute one cell, the tile map is only touched if its state changed
+static void RepaintBoardCell(Board *board, TileMap *tileMap, GameState *gameState, Snake *snake, Booster *booster, Vector2 position) {
+    int x = (int)position.x;
+    int y = (int)position.y;
+    if (x < 0 || x >= gameState->mapWidth || y < 0 || y >= gameState->mapHeight) return;
+
+    unsigned char state = GetBoardCellState(gameState, snake, booster, position);
+    if (board->cells[y * gameState->mapWidth + x] != state) {
+        board->cells[y * gameState->mapWidth + x] = state;
+        SetTileMapCell(tileMap, x, y, GetCellColor(state));
+    }
+}
+
+// remember the painted elements, UpdateBoard() repaints the cells they leave or reach
+static void SavePaintedCells(Board *board, Snake *snake, Booster *booster) {
+    board->snakeHead = snake->body[0];
+    board->snakeTail = snake->body[snake->length - 1];
+    board->snakeLength = snake->length;
+    board->letters[0] = letter1.position;
+    board->letters[1] = letter2.position;
+    board->booster = *booster;
+}
+
+Board LoadBoard(TileMap *tileMap, GameState *gameState, Snake *snake, Booster *booster) {
+    Board board = { 0 };
+    board.cells = (unsigned char *)calloc(gameState->mapWidth * gameState->mapHeight, 1);
+    ResetBoard(&board, tileMap, gameState, snake, booster);
+    return board;
+}
+
+void UnloadBoard(Board board) {
+    free(board.cells);
+}
+
+// paint every cell again with the staging functions, used when the changed cells are not known (snake reset or shortened)
+void ResetBoard(Board *board, TileMap *tileMap, GameState *gameState, Snake *snake, Booster *booster) {
+    memset(board->cells, CELL_EMPTY, gameState->mapWidth * gameState->mapHeight);
+    DrawWalls(board->cells, gameState);
+    DrawSnake(board->cells, gameState, snake);
+    DrawLetterCells(board->cells, gameState, &letter1, &letter2);
+    DrawBooster(board->cells, gameState, booster);
+
+    // only cells with a new color mark their chunk dirty
+    for (int y = 0; y < gameState->mapHeight; y++) {
+        for (int x = 0; x < gameState->mapWidth; x++) {
+            SetTileMapCell(tileMap, x, y, GetCellColor(board->cells[y * gameState->mapWidth + x]));
+        }
+    }
+
+    SavePaintedCells(board, snake, booster);
+}
+
+// repaint only the cells changed since the last update
+void UpdateBoard(Board *board, TileMap *tileMap, GameState *gameState, Snake *snake, Booster *booster) {
+    Vector2 head = snake->body[0];
+    Vector2 tail = snake->body[snake->length - 1];
+
+    if (!SameCell(head, board->snakeHead) || !SameCell(tail, board->snakeTail)) {
+        // one step forward (the snake may have grown by one): the old tail is left and the new head reached
+        bool stepped = (snake->length == 1 && board->snakeLength == 1) ||
+                       (snake->length > 1 && SameCell(snake->body[1], board->snakeHead) &&
+                        (snake->length == board->snakeLength || snake->length == board->snakeLength + 1));
+
+        if (!stepped) {
+            ResetBoard(board, tileMap, gameState, snake, booster);
+            return;
+        }
+
+        RepaintBoardCell(board, tileMap, gameState, snake, booster, board->snakeTail);
+        RepaintBoardCell(board, tileMap, gameState, snake, booster, head);
+    } else if (snake->length < board->snakeLength) {
+        ResetBoard(board, tileMap, gameState, snake, booster);
+        return;
+    }
+
+    if (!SameCell(letter1.position, board->letters[0]) || !SameCell(letter2.position, board->letters[1])) {
+        RepaintBoardCell(board, tileMap, gameState, snake, booster, board->letters[0]);
+        RepaintBoardCell(board, tileMap, gameState, snake, booster, board->letters[1]);
+        RepaintBoardCell(board, tileMap, gameState, snake, booster, letter1.position);
+        RepaintBoardCell(board, tileMap, gameState, snake, booster, letter2.position);
+    }
+
+    if (booster->isActive != board->booster.isActive || booster->type != board->booster.type ||
+        !SameCell(booster->position, board->booster.position)) {
+        RepaintBoardCell(board, tileMap, gameState, snake, booster, board->booster.position);
+        RepaintBoardCell(board, tileMap, gameState, snake, booster, booster->position);
+    }
+
+    SavePaintedCells(board, snake, booster);
+}
+
+/* ------------------------- SHADER BOARD ------------------------- */
+
+// every pixel color is picked from the palette with the state of its cell (one texel per cell)
+static const char *shaderBoardCode =
+    "#version 330\n"
+    "in vec2 fragTexCoord;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform vec4 palette[7];\n" // CELL_STATES colors
+    "uniform vec2 boardSize;\n"
+    "out vec4 finalColor;\n"
+    "void main() {\n"
+    "    ivec2 cell = ivec2(fragTexCoord * boardSize);\n"
+    "    int state = int(texelFetch(texture0, cell, 0).r * 255.0 + 0.5);\n"
+    "    finalColor = palette[state];\n"
+    "}\n";
+
+ShaderBoard LoadShaderBoard(GameState *gameState) {
+    ShaderBoard shaderBoard = { 0 };
+
+    Image image = { 0 };
+    image.data = calloc(gameState->mapWidth * gameState->mapHeight, 1);
+    image.width = gameState->mapWidth;
+    image.height = gameState->mapHeight;
+    image.mipmaps = 1;
+    image.format = UNCOMPRESSED_GRAYSCALE;
+    shaderBoard.states = LoadTextureFromImage(image);
+    shaderBoard.uploaded = image.data; // the texture is all CELL_EMPTY, like the image data
+
+    shaderBoard.shader = LoadShaderCode(NULL, shaderBoardCode);
+    shaderBoard.boardSizeLoc = GetShaderLocation(shaderBoard.shader, "boardSize");
+
+    Vector2 boardSize = { gameState->mapWidth, gameState->mapHeight };
+    SetShaderValue(shaderBoard.shader, shaderBoard.boardSizeLoc, &boardSize, UNIFORM_VEC2);
+
+    float palette[CELL_STATES * 4];
+    for (int i = 0; i < CELL_STATES; i++) {
+        Vector4 color = ColorNormalize(GetCellColor(i));
+        palette[i * 4 + 0] = color.x;
+        palette[i * 4 + 1] = color.y;
+        palette[i * 4 + 2] = color.z;
+        palette[i * 4 + 3] = color.w;
+    }
+    SetShaderValueV(shaderBoard.shader, GetShaderLocation(shaderBoard.shader, "palette"), palette, UNIFORM_VEC4, CELL_STATES);
+
+    return shaderBoard;
+}
+
+void UnloadShaderBoard(ShaderBoard shaderBoard) {
+    UnloadShader(shaderBoard.shader);
+    UnloadTexture(shaderBoard.states);
+    free(shaderBoard.uploaded);
+}
+
+// upload only the changed cells (1x1 sub-rectangles) and draw the board with a single quad
+void DrawShaderBoard(ShaderBoard *shaderBoard, unsigned char *board, GameState *gameState) {
+    for (int y = 0; y < gameState->mapHeight; y++) {
+        for (int x = 0; x < gameState->mapWidth; x++) {
+            int i = y * gameState->mapWidth + x;
+            if (shaderBoard->uploaded[i] != board[i]) {
+                UpdateTextureRec(shaderBoard->states, (Rectangle){ x, y, 1, 1 }, &board[i]);
+                shaderBoard->uploaded[i] = board[i];
+            }
+        }
+    }
+
+    BeginShaderMode(shaderBoard->shader);
+    DrawTextureEx(shaderBoard->states, (Vector2){0, VERTICAL_OFFSET}, 0.0f, GRID_CELL_SIZE, WHITE);
+    EndShaderMode();
+}
+
+void DrawGuessedWord(GameState *gameState) {
+    DrawText(TextFormatFrame("Word: %s", gameState->guessedWord), 10, 40, 20, YELLOW);
+}
+
+void DrawLetters(Letter *letter1, Letter *letter2) {
+    DrawText(&letter1->value, letter1->position.x * GRID_CELL_SIZE + 5,
+             letter1->position.y * GRID_CELL_SIZE + VERTICAL_OFFSET -2, 20, WHITE);
+
+    DrawText(&letter2->value, letter2->position.x * GRID_CELL_SIZE + 5,
+             letter2->position.y * GRID_CELL_SIZE + VERTICAL_OFFSET - 2, 20, WHITE);
+}
+
+void DrawGameOver(Texture2D lost_image) {
+    float scale = 0.3f; 
+    int scaledWidth = lost_image.width * scale;
+    int scaledHeight = lost_image.height * scale;
+    DrawText("YOU LOST...", 10, 10, 30, RED);
+    DrawText("Press R to restart or ESC to exit.", 10, 40, 20, RAYWHITE);
+    DrawTextureEx(lost_image, (Vector2){10, 70}, 0.0f, scale, WHITE);
+
+}
+
+void DrawGameWon(char *currentWord, Texture2D won_image) {
+    float scale = 0.3f;  
+    int scaledWidth = won_image.width * scale;
+    int scaledHeight = won_image.height * scale;
+    DrawText("YOU WON!", 10, 10, 30, BLUE);
+    DrawText(TextFormatFrame("Word found: %s", currentWord), 10, 40, 25, BLUE);
+    DrawText("Press R to restart or ESC to exit.", 10, 70, 20, RAYWHITE);
+    DrawTextureEx(won_image, (Vector2){10, 100}, 0.0f, scale, WHITE);
+
+}
+
+void drawMapSizeInfo(Texture2D snake_image, GameState *gameState) {
+    BeginDrawing();
+    ClearBackground(BLACK);
+
+    float scale = 0.1f;  
+    int scaledWidth = snake_image.width * scale;
+    int scaledHeight = snake_image.height * scale;
+    DrawTextureEx(snake_image, (Vector2){10, 10}, 0.0f, scale, WHITE);
+    
+    DrawText("Use arrow keys to change the map size.", 10, 140, 20, RAYWHITE);
+    DrawText(TextFormatFrame("Width: %i", gameState->mapWidth), 10, 170, 20, RAYWHITE);
+    DrawText(TextFormatFrame("Height: %i", gameState->mapHeight), 10, 200, 20, RAYWHITE);
+    DrawText("Press ENTER to confirm.", 10, 230, 20, RAYWHITE);
+
+    EndDrawing();
+}
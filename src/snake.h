@@ -0,0 +1,117 @@
+#ifndef SNAKE_H
+#define SNAKE_H
+
+#include "raylib.h"
+#include "rtilemap.h"
+
+#define MIN_SIZE 5
+#define MAX_SIZE 20
+#define SNAKE_INITIAL_LENGTH 1
+#define GRID_CELL_SIZE 20
+#define MOVEMENT_INTERVAL 0.5f
+#define VERTICAL_OFFSET 110
+#define BOOSTER_RESPAWN_TIME 6.0f
+
+// board cell states, also used as values of the shader board state texture
+#define CELL_EMPTY 0
+#define CELL_WALL 1
+#define CELL_SNAKE 2
+#define CELL_LETTER 3
+#define CELL_BOOSTER_SPEED 4
+#define CELL_BOOSTER_SIZE 5
+#define CELL_BOOSTER_LIFE 6
+#define CELL_STATES 7
+
+/* ------------------------- STRUCTURES ------------------------- */
+
+typedef struct Snake {
+    Vector2 *body;
+    int length;
+    Vector2 direction;
+} Snake;
+
+typedef struct Booster {
+    Vector2 position;
+    bool isActive;
+    int type; // (0 = speed, 1 = size reducer, 2 = extra life)
+} Booster;
+
+typedef struct Letter {
+    Vector2 position;
+    char value;
+} Letter;
+extern Letter letter1, letter2;
+
+typedef struct GameState {
+    int mapWidth;
+    int mapHeight;
+    float normalSpeed;
+    float boostedSpeed;
+    float speedDuration;
+    float boosterTimer;
+    float currentSpeed;
+    int extraLives;
+    const char *wordList[3];
+    char currentWord[20];
+    char guessedWord[20];
+    int currentWordLength;
+    char letterChoices[2];
+    Letter letter1;
+    Letter letter2;
+} GameState;
+
+// board cells kept between frames: only the cells that change (snake head and tail, letters, booster)
+// are repainted, and only those are set on the tile map
+typedef struct Board {
+    unsigned char *cells;    // cell states (mapWidth * mapHeight)
+    Vector2 snakeHead;       // snake cells painted on the board
+    Vector2 snakeTail;
+    int snakeLength;
+    Vector2 letters[2];      // letter cells painted on the board
+    Booster booster;         // booster painted on the board
+} Board;
+
+// alternative board renderer: the cell states live in a small grayscale (R8) texture,
+// one fragment shader draws the whole board picking every pixel color from its cell state
+typedef struct ShaderBoard {
+    Shader shader;
+    Texture2D states;        // one texel per cell, value is the cell state
+    unsigned char *uploaded; // cell states currently on the GPU
+    int boardSizeLoc;
+} ShaderBoard;
+
+/* ------------------------- GAME FUNCTIONS ------------------------- */
+
+void InitSnake(Snake *snake, GameState *gameState);
+void InitBooster(Booster *booster, int type, GameState *gameState);
+void MoveSnake(Snake *snake);
+void InitWordGame(GameState *gameState);
+void GenerateLetterChoices(GameState *gameState);
+int CheckCollision(Snake *snake, GameState *gameState);
+int CheckLetterCollision(Snake *snake, Letter *letter);
+int CheckBoosterCollision(Snake *snake, Booster *booster, Sound boosterSound);
+void HandleLetterCollision(Snake *snake, GameState *gameState, Letter *letter, Sound eatSound);
+void HandleSizeReducer(Snake *snake);
+void HandleCollision(Snake *snake, GameState *gameState, bool *isGameRunning);
+void RestartGame(Snake *snake, GameState *gameState, int *currentWordLength, bool *isGameRunning);
+void PaintCell(unsigned char *board, GameState *gameState, Vector2 position, unsigned char state);
+Color GetCellColor(unsigned char state);
+void DrawSnake(unsigned char *board, GameState *gameState, Snake *snake);
+void DrawWalls(unsigned char *board, GameState *gameState);
+void DrawBooster(unsigned char *board, GameState *gameState, Booster *booster);
+void DrawLetterCells(unsigned char *board, GameState *gameState, Letter *letter1, Letter *letter2);
+void DrawBoard(TileMap *tileMap, unsigned char *board, GameState *gameState);
+Board LoadBoard(TileMap *tileMap, GameState *gameState, Snake *snake, Booster *booster);
+void UnloadBoard(Board board);
+void ResetBoard(Board *board, TileMap *tileMap, GameState *gameState, Snake *snake, Booster *booster);
+void UpdateBoard(Board *board, TileMap *tileMap, GameState *gameState, Snake *snake, Booster *booster);
+ShaderBoard LoadShaderBoard(GameState *gameState);
+void UnloadShaderBoard(ShaderBoard shaderBoard);
+void DrawShaderBoard(ShaderBoard *shaderBoard, unsigned char *board, GameState *gameState);
+void DrawGuessedWord(GameState *gameState);
+void DrawLetters(Letter *letter1, Letter *letter2);
+void DrawGameOver(Texture2D lost_image);
+void DrawGameWon(char *currentWord, Texture2D won_image);
+void drawMapSizeInfo(Texture2D snake_image, GameState *gameState);
+
+#endif // SNAKE_H
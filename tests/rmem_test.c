@@ -0,0 +1,67 @@
+#include "rmem.h"
+#include <stdio.h>
+
+// memory pool regression checks, no window needed: frees must never corrupt the pool free lists
+
+#define TEST_POOL_SIZE 4096
+
+static int failures = 0;
+
+#define CHECK(condition, ...) do { \
+    if (!(condition)) { \
+        failures++; \
+        printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+        printf(__VA_ARGS__); \
+        printf("\n"); \
+    } \
+} while (0)
+
+// freeing a block already merged into a free neighbour must be ignored, the pool must end fully free
+static void TestDoubleFreeOfMergedBlock(void) {
+    MemPool pool = CreateMemPool(TEST_POOL_SIZE);
+    size_t freeMemory = GetMemPoolFreeMemory(pool);
+
+    void *a = MemPoolAlloc(&pool, 64);
+    void *b = MemPoolAlloc(&pool, 64);
+    void *c = MemPoolAlloc(&pool, 64);
+    CHECK(a != NULL && b != NULL && c != NULL, "pool allocations failed");
+
+    MemPoolFree(&pool, b);
+    MemPoolFree(&pool, a);      // merges free b into a
+    MemPoolFree(&pool, b);      // double free of the merged block
+    MemPoolFree(&pool, c);
+
+    CHECK(GetMemPoolFreeMemory(pool) == freeMemory, "pool free memory %zu after frees, expected %zu",
+          GetMemPoolFreeMemory(pool), freeMemory);
+
+    DestroyMemPool(&pool);
+}
+
+// same with the freed block merged into its free previous neighbour
+static void TestDoubleFreeOfMergedPrevBlock(void) {
+    MemPool pool = CreateMemPool(TEST_POOL_SIZE);
+    size_t freeMemory = GetMemPoolFreeMemory(pool);
+
+    void *a = MemPoolAlloc(&pool, 64);
+    void *b = MemPoolAlloc(&pool, 64);
+    void *c = MemPoolAlloc(&pool, 64);
+    CHECK(a != NULL && b != NULL && c != NULL, "pool allocations failed");
+
+    MemPoolFree(&pool, a);
+    MemPoolFree(&pool, b);      // merges b into a
+    MemPoolFree(&pool, b);      // double free of the merged block
+    MemPoolFree(&pool, c);
+
+    CHECK(GetMemPoolFreeMemory(pool) == freeMemory, "pool free memory %zu after frees, expected %zu",
+          GetMemPoolFreeMemory(pool), freeMemory);
+
+    DestroyMemPool(&pool);
+}
+
+int main(void) {
+    TestDoubleFreeOfMergedBlock();
+    TestDoubleFreeOfMergedPrevBlock();
+
+    if (failures == 0) printf("rmem_test: all checks passed\n");
+    return (failures == 0)? 0 : 1;
+}
@@ -0,0 +1,70 @@
+#include "raylib.h"
+#include <stdio.h>
+
+// text layout cache regression checks, drawn on a hidden window: cached text must render the same
+// pixels as uncached text, also when the batch is nearly full and the cached quads force a flush
+
+#define SCREEN_WIDTH 320
+#define SCREEN_HEIGHT 120
+#define BATCH_FILL_RECTANGLES 8188      // leaves the batch a few quads short of full
+
+static int failures = 0;
+
+#define CHECK(condition, ...) do { \
+    if (!(condition)) { \
+        failures++; \
+        printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+        printf(__VA_ARGS__); \
+        printf("\n"); \
+    } \
+} while (0)
+
+// draws the text three frames in a row (cached on second use) and counts its white pixels
+static int DrawTextPixels(bool fillBatch) {
+    int whitePixels = 0;
+
+    for (int frame = 0; frame < 3; frame++) {
+        BeginDrawing();
+        ClearBackground(BLACK);
+
+        if (fillBatch) {
+            for (int i = 0; i < BATCH_FILL_RECTANGLES; i++) DrawRectangle(0, SCREEN_HEIGHT - 1, 1, 1, DARKGRAY);
+        }
+        DrawText("HIHI", 10, 10, 40, WHITE);
+
+        EndDrawing();
+    }
+
+    Image screen = GetScreenData();
+    Color *pixels = (Color *)screen.data;
+    for (int i = 0; i < screen.width * screen.height; i++) {
+        if (pixels[i].r == 255 && pixels[i].g == 255 && pixels[i].b == 255) whitePixels++;
+    }
+    UnloadImage(screen);
+
+    return whitePixels;
+}
+
+int main(void) {
+    SetTraceLogLevel(LOG_WARNING);
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "text_cache_test");
+
+    SetTextLayoutCacheBudget(0);
+    int uncached = DrawTextPixels(false);
+    int uncachedFull = DrawTextPixels(true);
+
+    SetTextLayoutCacheBudget(256 * 1024);
+    int cached = DrawTextPixels(false);
+    int cachedFull = DrawTextPixels(true);
+
+    CHECK(uncached > 0, "uncached text drew no pixels");
+    CHECK(uncachedFull == uncached, "uncached text with full batch: %d white pixels, expected %d", uncachedFull, uncached);
+    CHECK(cached == uncached, "cached text: %d white pixels, expected %d", cached, uncached);
+    CHECK(cachedFull == uncached, "cached text with full batch: %d white pixels, expected %d", cachedFull, uncached);
+
+    CloseWindow();
+
+    if (failures == 0) printf("text_cache_test: all checks passed\n");
+    return (failures == 0)? 0 : 1;
+}